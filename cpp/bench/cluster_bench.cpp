@@ -0,0 +1,431 @@
+// Runs a whole cluster in this process (see local_cluster.h), drives it with
+// an open-loop Poisson load that can change rate over time, kills and
+// restarts nodes on a schedule, and reports how long leader failover took,
+// task throughput, tasks lost with killed nodes, and load imbalance.
+//
+// Usage: ./cluster_bench [--nodes=5] [--seconds=30] [--load=0:200,10:800]
+//                        [--task_ms=20] [--kill=10:leader] [--restart=20:last]
+//                        [--submit=random|first] [--poll_ms=50] [--drain_s=10]
+//                        [--seed=1] [any server flag, e.g. --dispatch=p2c]
+// --load is from_second:tasks_per_second pairs. --kill takes a node index or
+// "leader", --restart an index or "last"; both may be repeated. Heartbeats,
+// elections and peer timeouts default to 200, 500 and 600 ms here.
+#include "local_cluster.h"
+#include "log.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+struct Action {
+    double at_s = 0.0;
+    bool kill = true;
+    int node = -1;  // -1: the leader for a kill, the last killed node for a restart
+};
+
+struct Config {
+    int seconds = 30;
+    std::vector<std::pair<double, double>> load = {{0.0, 200.0}};  // from second, tasks/s
+    int task_ms = 20;
+    bool submit_first = false;  // send every task to the first live node, not a random one
+    std::vector<Action> actions;
+    int poll_ms = 50;
+    int drain_s = 10;
+    unsigned seed = 1;
+};
+
+struct Failover {
+    double killed_s = 0.0;
+    std::string old_leader;
+    double recovered_s = -1.0;
+    std::string new_leader;
+};
+
+// What the cluster last reported, polled through GetStats
+struct Monitor {
+    std::mutex mutex;
+    std::vector<int> generation;      // bumped on every kill, so stale polls are dropped
+    std::vector<int64_t> banked;      // completed by earlier lives of the node
+    std::vector<int64_t> completed;   // by its current life
+    std::vector<std::string> leader;  // as the node sees it
+    std::vector<int> queue;
+    std::string agreed;               // leader every live node agrees on, if any
+    double first_agreement_s = -1.0;
+    int leader_changes = 0;
+    std::vector<Failover> failovers;
+};
+
+static bool parse_action(const std::string& value, bool kill, Action* action) {
+    size_t colon = value.find(':');
+    if (colon == std::string::npos) {
+        return false;
+    }
+    action->at_s = std::atof(value.substr(0, colon).c_str());
+    action->kill = kill;
+    std::string node = value.substr(colon + 1);
+    action->node = node == (kill ? "leader" : "last") ? -1 : std::atoi(node.c_str());
+    return true;
+}
+
+static bool parse_load(const std::string& value, Config* config) {
+    config->load.clear();
+    size_t start = 0;
+    while (start < value.size()) {
+        size_t comma = value.find(',', start);
+        std::string step = value.substr(start, comma == std::string::npos ? std::string::npos : comma - start);
+        size_t colon = step.find(':');
+        if (colon == std::string::npos) {
+            return false;
+        }
+        config->load.emplace_back(std::atof(step.substr(0, colon).c_str()),
+                                  std::max(0.0, std::atof(step.substr(colon + 1).c_str())));
+        if (comma == std::string::npos) {
+            break;
+        }
+        start = comma + 1;
+    }
+    std::sort(config->load.begin(), config->load.end());
+    return !config->load.empty();
+}
+
+static bool parse_option(const std::string& arg, Config* config, ClusterOptions* cluster) {
+    size_t eq = arg.find('=');
+    if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+        return false;
+    }
+    std::string name = arg.substr(2, eq - 2);
+    std::string value = arg.substr(eq + 1);
+
+    if (name == "nodes") {
+        cluster->nodes = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "seconds") {
+        config->seconds = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "load") {
+        return parse_load(value, config);
+    } else if (name == "task_ms") {
+        config->task_ms = std::max(0, std::atoi(value.c_str()));
+    } else if (name == "kill" || name == "restart") {
+        Action action;
+        if (!parse_action(value, name == "kill", &action)) {
+            return false;
+        }
+        config->actions.push_back(action);
+    } else if (name == "submit") {
+        if (value != "random" && value != "first") {
+            return false;
+        }
+        config->submit_first = value == "first";
+    } else if (name == "poll_ms") {
+        config->poll_ms = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "drain_s") {
+        config->drain_s = std::max(0, std::atoi(value.c_str()));
+    } else if (name == "seed") {
+        config->seed = static_cast<unsigned>(std::atoi(value.c_str()));
+    } else {
+        return parse_node_option(arg, &cluster->node);
+    }
+    return true;
+}
+
+static double rate_at(const Config& config, double t_s) {
+    double rate = 0.0;
+    for (const auto& [from_s, tasks_per_s] : config.load) {
+        if (from_s <= t_s) {
+            rate = tasks_per_s;
+        }
+    }
+    return rate;
+}
+
+static double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void poll(LocalCluster& cluster, Monitor& monitor, Clock::time_point start) {
+    for (int i = 0; i < cluster.size(); ++i) {
+        if (!cluster.alive(i)) {
+            continue;
+        }
+        int generation;
+        {
+            std::lock_guard<std::mutex> lock(monitor.mutex);
+            generation = monitor.generation[i];
+        }
+        leader::NodeStats stats;
+        if (!cluster.Stats(i, &stats, 200)) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(monitor.mutex);
+        if (generation == monitor.generation[i]) {
+            monitor.completed[i] = stats.tasks_completed();
+            monitor.leader[i] = stats.leader_id();
+            monitor.queue[i] = stats.queue_length();
+        }
+    }
+
+    // Failover is over once every live node names the same live leader
+    std::lock_guard<std::mutex> lock(monitor.mutex);
+    std::string agreed;
+    for (int i = 0; i < cluster.size(); ++i) {
+        if (!cluster.alive(i)) {
+            continue;
+        }
+        if (monitor.leader[i].empty() || (!agreed.empty() && monitor.leader[i] != agreed)) {
+            return;
+        }
+        agreed = monitor.leader[i];
+    }
+    int leader = cluster.index_of(agreed);
+    if (leader < 0 || !cluster.alive(leader)) {
+        return;
+    }
+    double now_s = seconds_since(start);
+    if (monitor.first_agreement_s < 0) {
+        monitor.first_agreement_s = now_s;
+    }
+    if (!monitor.agreed.empty() && agreed != monitor.agreed) {
+        ++monitor.leader_changes;
+    }
+    monitor.agreed = agreed;
+    for (Failover& f : monitor.failovers) {
+        if (f.recovered_s < 0 && agreed != f.old_leader) {
+            f.recovered_s = now_s;
+            f.new_leader = agreed;
+        }
+    }
+}
+
+static void kill_node(LocalCluster& cluster, Monitor& monitor, int i, Clock::time_point start) {
+    // Bank what it finished; whatever it still has queued is lost with it
+    leader::NodeStats stats;
+    bool have_stats = cluster.Stats(i, &stats, 200);
+    {
+        std::lock_guard<std::mutex> lock(monitor.mutex);
+        monitor.banked[i] += have_stats ? stats.tasks_completed() : monitor.completed[i];
+        if (cluster.address(i) == monitor.agreed) {
+            Failover f;
+            f.killed_s = seconds_since(start);
+            f.old_leader = cluster.address(i);
+            monitor.failovers.push_back(f);
+        }
+    }
+    // Not under the monitor lock: Kill waits for the node's RPCs to drain
+    cluster.Kill(i);
+    // Drop anything a poll read from the node while it was going down
+    std::lock_guard<std::mutex> lock(monitor.mutex);
+    ++monitor.generation[i];
+    monitor.completed[i] = 0;
+    monitor.leader[i].clear();
+    monitor.queue[i] = 0;
+}
+
+int main(int argc, char** argv) {
+    Config config;
+    ClusterOptions cluster_options;
+    cluster_options.node.heartbeat_interval_ms = 200;
+    cluster_options.node.election_interval_ms = 500;
+    cluster_options.node.peer_timeout_ms = 600;
+    set_log_level(LogLevel::WARN);
+    for (int i = 1; i < argc; ++i) {
+        if (!parse_option(argv[i], &config, &cluster_options)) {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    std::sort(config.actions.begin(), config.actions.end(),
+              [](const Action& a, const Action& b) { return a.at_s < b.at_s; });
+
+    LocalCluster cluster(cluster_options);
+    if (!cluster.Start()) {
+        std::fprintf(stderr, "Could not start the cluster\n");
+        return 1;
+    }
+    const int n = cluster.size();
+    std::printf("%d nodes, heartbeat %d ms, election %d ms, peer timeout %d ms, %ds of load\n", n,
+                cluster_options.node.heartbeat_interval_ms, cluster_options.node.election_interval_ms,
+                cluster_options.node.peer_timeout_ms, config.seconds);
+
+    Monitor monitor;
+    monitor.generation.assign(n, 0);
+    monitor.banked.assign(n, 0);
+    monitor.completed.assign(n, 0);
+    monitor.leader.assign(n, "");
+    monitor.queue.assign(n, 0);
+
+    auto start = Clock::now();
+    std::atomic<bool> done{false};
+    std::thread poller([&] {
+        while (!done.load()) {
+            poll(cluster, monitor, start);
+            std::this_thread::sleep_for(std::chrono::milliseconds(config.poll_ms));
+        }
+    });
+
+    // Open-loop sender: Poisson arrivals at the current step's rate
+    std::atomic<int64_t> sent{0};
+    std::atomic<int64_t> acked{0};
+    std::atomic<int64_t> errors{0};
+    std::atomic<int64_t> in_flight{0};
+    std::thread sender([&] {
+        std::mt19937 rng(config.seed);
+        auto end = start + std::chrono::seconds(config.seconds);
+        auto next = start;
+        int32_t task_id = 0;
+        while (true) {
+            double rate = rate_at(config, seconds_since(start));
+            if (rate <= 0.0) {
+                next += std::chrono::milliseconds(10);
+            } else {
+                double gap_s = std::exponential_distribution<double>(rate)(rng);
+                next += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(gap_s));
+            }
+            if (next >= end) {
+                break;
+            }
+            std::this_thread::sleep_until(next);
+            if (rate <= 0.0) {
+                continue;
+            }
+
+            std::vector<int> live;
+            for (int i = 0; i < n; ++i) {
+                if (cluster.alive(i)) {
+                    live.push_back(i);
+                }
+            }
+            if (live.empty()) {
+                errors.fetch_add(1);
+                continue;
+            }
+            int target = config.submit_first ? live.front()
+                                             : live[std::uniform_int_distribution<size_t>(0, live.size() - 1)(rng)];
+            struct Call {
+                grpc::ClientContext context;
+                leader::Task task;
+                leader::Ack ack;
+            };
+            auto* call = new Call;
+            call->task.set_task_id(task_id++);
+            call->task.set_duration_ms(config.task_ms);
+            call->context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(2));
+            sent.fetch_add(1);
+            in_flight.fetch_add(1);
+            cluster.stub(target)->async()->AssignTask(&call->context, &call->task, &call->ack,
+                                                      [call, &acked, &errors, &in_flight](grpc::Status s) {
+                                                          (s.ok() ? acked : errors).fetch_add(1);
+                                                          in_flight.fetch_sub(1);
+                                                          delete call;
+                                                      });
+        }
+    });
+
+    // Kills and restarts, on the main thread
+    std::vector<int> killed;
+    for (const Action& action : config.actions) {
+        if (action.at_s >= config.seconds) {
+            break;
+        }
+        std::this_thread::sleep_until(start + std::chrono::duration_cast<Clock::duration>(
+                                                  std::chrono::duration<double>(action.at_s)));
+        int node = action.node;
+        if (action.kill && node < 0) {
+            std::lock_guard<std::mutex> lock(monitor.mutex);
+            node = cluster.index_of(monitor.agreed);
+        } else if (!action.kill && node < 0 && !killed.empty()) {
+            node = killed.back();
+        }
+        if (node < 0 || node >= n) {
+            std::printf("%6.2fs  no node to %s\n", seconds_since(start), action.kill ? "kill" : "restart");
+            continue;
+        }
+        if (action.kill) {
+            kill_node(cluster, monitor, node, start);
+            killed.push_back(node);
+            std::printf("%6.2fs  killed %s\n", seconds_since(start), cluster.address(node).c_str());
+        } else {
+            bool ok = cluster.Restart(node);
+            std::printf("%6.2fs  restarted %s%s\n", seconds_since(start), cluster.address(node).c_str(),
+                        ok ? "" : " (failed)");
+        }
+    }
+    sender.join();
+    while (in_flight.load() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    double load_s = seconds_since(start);
+    int64_t completed_in_load = 0;
+    {
+        std::lock_guard<std::mutex> lock(monitor.mutex);
+        for (int i = 0; i < n; ++i) {
+            completed_in_load += monitor.banked[i] + monitor.completed[i];
+        }
+    }
+
+    // Let the queues drain so lost tasks can be told from late ones
+    auto drain_end = Clock::now() + std::chrono::seconds(config.drain_s);
+    auto last_progress = Clock::now();
+    int64_t last_done = -1;
+    while (Clock::now() < drain_end) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(config.poll_ms));
+        std::lock_guard<std::mutex> lock(monitor.mutex);
+        int64_t done_now = 0;
+        int queued = 0;
+        for (int i = 0; i < n; ++i) {
+            done_now += monitor.banked[i] + monitor.completed[i];
+            queued += monitor.queue[i];
+        }
+        if (done_now != last_done) {
+            last_done = done_now;
+            last_progress = Clock::now();
+        }
+        // Done when everything acked has run, or nothing is queued and nothing finishes
+        if (queued == 0 && (done_now >= acked.load() || Clock::now() - last_progress > std::chrono::seconds(1))) {
+            break;
+        }
+    }
+    done.store(true);
+    poller.join();
+    poll(cluster, monitor, start);
+    cluster.StopAll();
+
+    std::lock_guard<std::mutex> lock(monitor.mutex);
+    std::vector<int64_t> per_node(n);
+    int64_t completed = 0;
+    for (int i = 0; i < n; ++i) {
+        per_node[i] = monitor.banked[i] + monitor.completed[i];
+        completed += per_node[i];
+    }
+    double mean = static_cast<double>(completed) / n;
+    int64_t most = *std::max_element(per_node.begin(), per_node.end());
+
+    std::printf("\nfirst leader agreed after %.0f ms, %d leader changes seen\n",
+                monitor.first_agreement_s * 1000.0, monitor.leader_changes);
+    for (const Failover& f : monitor.failovers) {
+        if (f.recovered_s < 0) {
+            std::printf("failover after killing %s at %.2fs: none\n", f.old_leader.c_str(), f.killed_s);
+        } else {
+            std::printf("failover after killing %s at %.2fs: %.0f ms, to %s\n", f.old_leader.c_str(),
+                        f.killed_s, (f.recovered_s - f.killed_s) * 1000.0, f.new_leader.c_str());
+        }
+    }
+    std::printf("sent %lld  acked %lld  errors %lld  completed %lld  lost %lld\n",
+                static_cast<long long>(sent.load()), static_cast<long long>(acked.load()),
+                static_cast<long long>(errors.load()), static_cast<long long>(completed),
+                static_cast<long long>(std::max<int64_t>(0, acked.load() - completed)));
+    std::printf("throughput %.1f tasks/s offered, %.1f tasks/s completed during load\n",
+                sent.load() / load_s, completed_in_load / load_s);
+    std::printf("imbalance (max / mean completed) %.2f:", mean > 0 ? most / mean : 0.0);
+    for (int i = 0; i < n; ++i) {
+        std::printf(" %lld", static_cast<long long>(per_node[i]));
+    }
+    std::printf("\n");
+    return 0;
+}
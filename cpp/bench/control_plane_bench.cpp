@@ -0,0 +1,521 @@
+// How the control plane scales with cluster size. For each N it measures
+// how long until a leader is agreed, then, over a quiet window, heartbeats
+// per second in and out of a node against what the configuration asks for,
+// how long a heartbeat round takes, and CPU and resident memory per node.
+// Last, each metric is fitted to c * N^k over the sizes, so a change to
+// StartHeartbeatLoop or ElectionLoop that alters k shows up directly.
+//
+// Usage: ./control_plane_bench [--peers=simulated|real] [--sizes=5,10,25,50,100,250,500]
+//                              [--window_s=5] [--agree_timeout_s=30] [--poll_ms=250]
+//                              [any server flag, e.g. --heartbeat_fanout=8]
+//
+// --peers=simulated, the default, runs one real node here and its N - 1
+// peers as stubs in a child process: they acknowledge heartbeats and send
+// their own at the node's interval and fanout, each with a fixed score above
+// any real one. CPU and memory are then one node's at cluster size N, on any
+// machine, and agreement is the node electing the best peer.
+// --peers=real runs all N as nodes in this process (see local_cluster.h), and
+// agreement is every node naming the same leader. They share this machine's
+// cores, so once those saturate the figures describe the box.
+//
+// Heartbeats, elections and peer timeouts default to 500, 1000 and 1500 ms here.
+#include "local_cluster.h"
+#include "log.h"
+#include "node_logic.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+extern char** environ;
+
+using Clock = std::chrono::steady_clock;
+
+struct Config {
+    bool simulated = true;
+    std::vector<int> sizes = {5, 10, 25, 50, 100, 250, 500};
+    int window_s = 5;
+    int agree_timeout_s = 30;
+    int poll_ms = 250;
+};
+
+// Per node: the mean over the cluster's nodes with real peers, the one
+// node with simulated ones
+struct Result {
+    int nodes = 0;
+    double agree_ms = -1.0;         // -1: no agreement within the timeout
+    bool agreed_after = false;      // still agreed after the window
+    double asked_out_per_s = 0.0;   // heartbeats the configuration sends
+    double out_per_s = 0.0;
+    double in_per_s = 0.0;
+    double failed_per_s = 0.0;
+    double round_ms = 0.0;          // mean over the rounds in the window
+    double cpu_ms_per_s = 0.0;      // CPU ms per second of wall time
+    double cpu_us_per_heartbeat = 0.0;  // over heartbeats sent and received
+    double rss_kb = 0.0;
+    double cluster_per_s = 0.0;     // heartbeat RPCs per second over the whole cluster
+};
+
+// Summed over every node that answered
+struct Sample {
+    double sent = 0.0;
+    double received = 0.0;
+    double failures = 0.0;
+    double round_count = 0.0;
+    double round_sum_ms = 0.0;
+    Clock::time_point at;
+};
+
+static bool parse_sizes(const std::string& value, std::vector<int>* sizes) {
+    sizes->clear();
+    size_t start = 0;
+    while (start <= value.size()) {
+        size_t comma = value.find(',', start);
+        int n = std::atoi(value.substr(start, comma == std::string::npos ? std::string::npos : comma - start).c_str());
+        if (n < 2) {
+            return false;
+        }
+        sizes->push_back(n);
+        if (comma == std::string::npos) {
+            break;
+        }
+        start = comma + 1;
+    }
+    return !sizes->empty();
+}
+
+static bool parse_option(const std::string& arg, Config* config, NodeOptions* node) {
+    size_t eq = arg.find('=');
+    if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+        return false;
+    }
+    std::string name = arg.substr(2, eq - 2);
+    std::string value = arg.substr(eq + 1);
+
+    if (name == "peers") {
+        if (value != "simulated" && value != "real") {
+            return false;
+        }
+        config->simulated = value == "simulated";
+    } else if (name == "sizes") {
+        return parse_sizes(value, &config->sizes);
+    } else if (name == "window_s") {
+        config->window_s = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "agree_timeout_s") {
+        config->agree_timeout_s = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "poll_ms") {
+        config->poll_ms = std::max(1, std::atoi(value.c_str()));
+    } else {
+        return parse_node_option(arg, node);
+    }
+    return true;
+}
+
+// Simulated peers. They answer every heartbeat and ignore the rest.
+class PeerStubService final : public leader::NodeService::Service {
+public:
+    grpc::Status Heartbeat(grpc::ServerContext*, const leader::NodeStatus*, leader::Ack* reply) override {
+        reply->set_message("ACK");
+        return grpc::Status::OK;
+    }
+};
+
+// The child process behind --peers=simulated. Serves count peers on ports
+// of their own and prints the ports on one line, reads the real node's
+// address from stdin, then sends each peer's heartbeats to it, as
+// heartbeat_targets() would pick them in a cluster listing the node first,
+// until stdin closes.
+static int run_peer_stubs(int count, int heartbeat_ms, int fanout) {
+    PeerStubService service;
+    grpc::ServerBuilder builder;
+    std::vector<int> ports(count, 0);
+    for (int& port : ports) {
+        builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    }
+    builder.RegisterService(&service);
+    std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    if (!server) {
+        return 1;
+    }
+    for (int i = 0; i < count; ++i) {
+        std::printf("%s127.0.0.1:%d", i > 0 ? "," : "", ports[i]);
+    }
+    std::printf("\n");
+    std::fflush(stdout);
+
+    std::string target;
+    if (!std::getline(std::cin, target)) {
+        return 0;
+    }
+    // One channel per peer, as the node would see from a real cluster
+    std::vector<std::unique_ptr<leader::NodeService::Stub>> stubs;
+    for (int i = 0; i < count; ++i) {
+        grpc::ChannelArguments args;
+        args.SetInt("control_plane_bench.peer", i);
+        stubs.push_back(leader::NodeService::NewStub(
+            grpc::CreateCustomChannel(target, grpc::InsecureChannelCredentials(), args)));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int64_t> in_flight{0};
+    std::thread sender([&] {
+        size_t peers = static_cast<size_t>(count) + 1;
+        auto start = Clock::now();
+        for (uint64_t round = 0; !done.load(); ++round) {
+            auto round_start = start + std::chrono::milliseconds(heartbeat_ms) * round;
+            for (int i = 0; i < count && !done.load(); ++i) {
+                std::vector<size_t> targets = heartbeat_targets(peers, i + 1, round, fanout);
+                if (std::find(targets.begin(), targets.end(), 0) == targets.end()) {
+                    continue;
+                }
+                // Spread over the interval, as unsynchronized nodes would be
+                std::this_thread::sleep_until(round_start + std::chrono::microseconds(
+                    static_cast<int64_t>(heartbeat_ms) * 1000 * i / count));
+                struct Call {
+                    grpc::ClientContext context;
+                    leader::NodeStatus status;
+                    leader::Ack ack;
+                };
+                auto* call = new Call;
+                call->status.set_node_id("127.0.0.1:" + std::to_string(ports[i]));
+                call->status.set_score(1e6f + i);  // the last peer is always the best
+                call->status.set_capacity(1);
+                call->context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(5));
+                in_flight.fetch_add(1);
+                stubs[i]->async()->Heartbeat(&call->context, &call->status, &call->ack,
+                                             [call, &in_flight](grpc::Status) {
+                                                 delete call;
+                                                 in_flight.fetch_sub(1);
+                                             });
+            }
+            std::this_thread::sleep_until(round_start + std::chrono::milliseconds(heartbeat_ms));
+        }
+    });
+    std::string line;
+    while (std::getline(std::cin, line)) {
+    }
+    done.store(true);
+    sender.join();
+    while (in_flight.load() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    server->Shutdown(std::chrono::system_clock::now() + std::chrono::milliseconds(100));
+    return 0;
+}
+
+// A running run_peer_stubs() child; closing its stdin ends it
+class PeerStubs {
+public:
+    ~PeerStubs() { Stop(); }
+
+    bool Start(const std::string& self, int count, const NodeOptions& node) {
+        int to_child[2];
+        int from_child[2];
+        if (pipe(to_child) != 0 || pipe(from_child) != 0) {
+            return false;
+        }
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, to_child[0], STDIN_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, from_child[1], STDOUT_FILENO);
+        posix_spawn_file_actions_addclose(&actions, to_child[1]);
+        posix_spawn_file_actions_addclose(&actions, from_child[0]);
+        std::vector<std::string> args = {self, "--peer_stubs=" + std::to_string(count),
+                                         "--heartbeat_ms=" + std::to_string(node.heartbeat_interval_ms),
+                                         "--heartbeat_fanout=" + std::to_string(node.heartbeat_fanout)};
+        std::vector<char*> argv;
+        for (std::string& arg : args) {
+            argv.push_back(&arg[0]);
+        }
+        argv.push_back(nullptr);
+        int error = posix_spawn(&pid_, self.c_str(), &actions, nullptr, argv.data(), environ);
+        posix_spawn_file_actions_destroy(&actions);
+        close(to_child[0]);
+        close(from_child[1]);
+        to_child_ = to_child[1];
+        from_child_ = fdopen(from_child[0], "r");
+        if (error != 0 || !from_child_) {
+            pid_ = -1;
+            return false;
+        }
+
+        std::string line;
+        int c;
+        while ((c = std::fgetc(from_child_)) != EOF && c != '\n') {
+            line += static_cast<char>(c);
+        }
+        size_t start = 0;
+        while (start < line.size()) {
+            size_t comma = line.find(',', start);
+            addresses_.push_back(line.substr(start, comma == std::string::npos ? std::string::npos : comma - start));
+            start = comma == std::string::npos ? line.size() : comma + 1;
+        }
+        return static_cast<int>(addresses_.size()) == count;
+    }
+
+    // Starts the heartbeats to the node at address
+    void Target(const std::string& address) {
+        std::string line = address + "\n";
+        if (write(to_child_, line.data(), line.size()) != static_cast<ssize_t>(line.size())) {
+            std::fprintf(stderr, "could not reach the peer stubs\n");
+        }
+    }
+
+    void Stop() {
+        if (to_child_ >= 0) {
+            close(to_child_);
+            to_child_ = -1;
+        }
+        if (from_child_) {
+            std::fclose(from_child_);
+            from_child_ = nullptr;
+        }
+        if (pid_ > 0) {
+            waitpid(pid_, nullptr, 0);
+            pid_ = -1;
+        }
+    }
+
+    const std::vector<std::string>& addresses() const { return addresses_; }
+
+private:
+    pid_t pid_ = -1;
+    int to_child_ = -1;
+    FILE* from_child_ = nullptr;
+    std::vector<std::string> addresses_;
+};
+
+static double cpu_ms() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+}
+
+static double rss_kb() {
+    long pages = 0;
+    if (FILE* f = std::fopen("/proc/self/statm", "r")) {
+        long size;
+        if (std::fscanf(f, "%ld %ld", &size, &pages) != 2) {
+            pages = 0;
+        }
+        std::fclose(f);
+    }
+    return pages * (sysconf(_SC_PAGESIZE) / 1024.0);
+}
+
+// The leader every node names, or "" while they differ or some have none
+static std::string agreed_leader(LocalCluster& cluster) {
+    std::string agreed;
+    for (int i = 0; i < cluster.size(); ++i) {
+        leader::NodeStats stats;
+        if (!cluster.Stats(i, &stats, 1000) || stats.leader_id().empty() ||
+            (!agreed.empty() && stats.leader_id() != agreed)) {
+            return "";
+        }
+        agreed = stats.leader_id();
+    }
+    return agreed;
+}
+
+static Sample sample(LocalCluster& cluster) {
+    Sample s;
+    auto begin = Clock::now();
+    for (int i = 0; i < cluster.size(); ++i) {
+        leader::NodeStats stats;
+        if (!cluster.Stats(i, &stats, 1000)) {
+            continue;
+        }
+        for (const leader::Metric& m : stats.metrics()) {
+            if (m.name() == "node_heartbeats_received_total") {
+                s.received += m.value();
+            } else if (m.name() == "node_heartbeat_failures_total") {
+                s.sent += m.value();
+                s.failures += m.value();
+            } else if (m.name() == "node_heartbeat_rtt_ms") {
+                s.sent += static_cast<double>(m.count());
+            } else if (m.name() == "node_heartbeat_round_ms") {
+                s.round_count += static_cast<double>(m.count());
+                s.round_sum_ms += m.sum();
+            }
+        }
+    }
+    // Counters were read over the pass, so date the sample at its middle
+    s.at = begin + (Clock::now() - begin) / 2;
+    return s;
+}
+
+static Result measure(int nodes, const Config& config, const NodeOptions& node, const std::string& self) {
+    Result r;
+    r.nodes = nodes;
+    int targets = node.heartbeat_fanout > 0 ? std::min(node.heartbeat_fanout, nodes - 1) : nodes - 1;
+    r.asked_out_per_s = targets * 1000.0 / node.heartbeat_interval_ms;
+
+    double rss_before = rss_kb();
+    PeerStubs stubs;
+    ClusterOptions options;
+    options.nodes = config.simulated ? 1 : nodes;
+    options.node = node;
+    if (config.simulated) {
+        if (!stubs.Start(self, nodes - 1, node)) {
+            std::fprintf(stderr, "could not start %d peer stubs\n", nodes - 1);
+            return r;
+        }
+        options.external_peers = stubs.addresses();
+    }
+    LocalCluster cluster(options);
+    if (!cluster.Start()) {
+        std::fprintf(stderr, "could not start %d nodes\n", options.nodes);
+        return r;
+    }
+    if (config.simulated) {
+        stubs.Target(cluster.address(0));
+    }
+    std::string best = config.simulated ? stubs.addresses().back() : "";
+    auto agreed = [&] {
+        std::string leader = agreed_leader(cluster);
+        return config.simulated ? leader == best : cluster.index_of(leader) >= 0;
+    };
+
+    // Heartbeats start at the end of Start(), so time agreement from there
+    auto started = Clock::now();
+    auto give_up = started + std::chrono::seconds(config.agree_timeout_s);
+    while (Clock::now() < give_up) {
+        if (agreed()) {
+            r.agree_ms = std::chrono::duration<double, std::milli>(Clock::now() - started).count();
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(config.poll_ms));
+    }
+
+    Sample first = sample(cluster);
+    double cpu_first = cpu_ms();
+    std::this_thread::sleep_for(std::chrono::seconds(config.window_s));
+    double cpu_last = cpu_ms();
+    Sample last = sample(cluster);
+    double rss_after = rss_kb();
+    r.agreed_after = agreed();
+
+    // Both sample passes fall outside the CPU window, which is window_s long
+    double seconds = std::chrono::duration<double>(last.at - first.at).count();
+    double sent = last.sent - first.sent;
+    double received = last.received - first.received;
+    r.out_per_s = sent / seconds / options.nodes;
+    r.in_per_s = received / seconds / options.nodes;
+    r.failed_per_s = (last.failures - first.failures) / seconds / options.nodes;
+    double rounds = last.round_count - first.round_count;
+    r.round_ms = rounds > 0 ? (last.round_sum_ms - first.round_sum_ms) / rounds : 0.0;
+    r.cpu_ms_per_s = (cpu_last - cpu_first) / config.window_s / options.nodes;
+    r.cpu_us_per_heartbeat = sent + received > 0 ? (cpu_last - cpu_first) * 1000.0 / (sent + received) : 0.0;
+    r.rss_kb = (rss_after - rss_before) / options.nodes;
+    r.cluster_per_s = r.out_per_s * nodes;
+
+    cluster.StopAll();
+    stubs.Stop();
+#ifdef __GLIBC__
+    malloc_trim(0);  // so the next size's baseline does not count this one's freed heap
+#endif
+    return r;
+}
+
+// Least squares fit of log(value) = log(c) + k log(nodes), over positive values
+static bool growth_exponent(const std::vector<Result>& results, double Result::*field, double* k) {
+    double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (const Result& r : results) {
+        if (r.*field <= 0) {
+            continue;
+        }
+        double x = std::log(r.nodes);
+        double y = std::log(r.*field);
+        n += 1;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+    if (n < 2 || n * sxx - sx * sx <= 0) {
+        return false;
+    }
+    *k = (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Config config;
+    NodeOptions node;
+    node.heartbeat_interval_ms = 500;
+    node.election_interval_ms = 1000;
+    node.peer_timeout_ms = 1500;
+    set_log_level(LogLevel::WARN);
+    int peer_stubs = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--peer_stubs=", 0) == 0) {
+            peer_stubs = std::atoi(arg.substr(13).c_str());
+        } else if (!parse_option(arg, &config, &node)) {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (peer_stubs > 0) {
+        return run_peer_stubs(peer_stubs, node.heartbeat_interval_ms, node.heartbeat_fanout);
+    }
+    std::signal(SIGPIPE, SIG_IGN);  // a peer stubs child that died is reported, not fatal
+
+    std::printf("%s peers, heartbeat %d ms, election %d ms, peer timeout %d ms, fanout %s, %d s window, %u cores\n",
+                config.simulated ? "simulated" : "real", node.heartbeat_interval_ms, node.election_interval_ms,
+                node.peer_timeout_ms, node.heartbeat_fanout > 0 ? std::to_string(node.heartbeat_fanout).c_str() : "all",
+                config.window_s, std::thread::hardware_concurrency());
+    std::printf("per node except cluster/s\n");
+    std::printf("%6s %9s %6s %8s %8s %8s %8s %9s %9s %9s %9s %11s\n", "nodes", "agree_ms", "stable", "asked/s",
+                "out/s", "in/s", "failed/s", "round_ms", "cpu_ms/s", "cpu_us/hb", "rss_kb", "cluster/s");
+    std::vector<Result> results;
+    for (int nodes : config.sizes) {
+        Result r = measure(nodes, config, node, argv[0]);
+        results.push_back(r);
+        std::printf("%6d %9.0f %6s %8.1f %8.1f %8.1f %8.1f %9.2f %9.2f %9.1f %9.0f %11.0f\n", r.nodes, r.agree_ms,
+                    r.agreed_after ? "yes" : "no", r.asked_out_per_s, r.out_per_s, r.in_per_s, r.failed_per_s,
+                    r.round_ms, r.cpu_ms_per_s, r.cpu_us_per_heartbeat, r.rss_kb, r.cluster_per_s);
+        std::fflush(stdout);
+    }
+
+    std::printf("\ngrowth with N, fitted as c * N^k:\n");
+    struct Metric {
+        const char* name;
+        double Result::*field;
+    };
+    const Metric metrics[] = {
+        {"time to agree", &Result::agree_ms},
+        {"heartbeats out per node", &Result::out_per_s},
+        {"heartbeats in per node", &Result::in_per_s},
+        {"cluster heartbeats", &Result::cluster_per_s},
+        {"heartbeat round", &Result::round_ms},
+        {"CPU per node", &Result::cpu_ms_per_s},
+        {"CPU per heartbeat", &Result::cpu_us_per_heartbeat},
+        {"memory per node", &Result::rss_kb},
+    };
+    for (const Metric& m : metrics) {
+        double k;
+        if (growth_exponent(results, m.field, &k)) {
+            std::printf("  %-24s N^%.2f\n", m.name, k);
+        } else {
+            std::printf("  %-24s too few positive points\n", m.name);
+        }
+    }
+    return 0;
+}
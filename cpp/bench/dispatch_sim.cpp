@@ -0,0 +1,144 @@
+// Compares dispatch policies on a simulated cluster where the dispatcher only
+// sees queue lengths as of the last heartbeat.
+//
+// Every node is a single FIFO server with exponential service times (mean 1).
+// Tasks arrive as a Poisson stream at rate load * nodes.
+//
+// First it checks that dispatch_load(), what PeerLoad() ranks peers by,
+// prefers the lower forecast wait to the shorter queue; it exits 1 if not.
+//
+// Usage: ./dispatch_sim [--nodes=100] [--load=0.9] [--tasks=1000000]
+//                       [--period=1.0] [--seed=1]
+#include "dispatch.h"
+#include "node_logic.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+struct SimConfig {
+    int nodes = 100;
+    double load = 0.9;
+    long tasks = 1000000;
+    double period = 1.0;  // heartbeat interval, in mean service times
+    unsigned seed = 1;
+};
+
+struct SimResult {
+    size_t max_queue = 0;
+    double p50_wait = 0.0;
+    double p99_wait = 0.0;
+    double mean_wait = 0.0;
+};
+
+// Two peers as their heartbeats describe them: a short queue of long tasks
+// that declared no duration, seen only in the forecast, and a longer queue of
+// short declared ones. Greedy and p2c must send to the second.
+struct PeerReport {
+    int queue_length;
+    int64_t backlog_ms;
+    float capacity;
+    float expected_wait_ms;
+};
+
+static bool check_peer_load() {
+    const PeerReport peers[] = {
+        {2, 0, 1.0f, 800.0f},     // 2 undeclared tasks of about 400 ms
+        {20, 200, 4.0f, 60.0f},   // 20 declared 10 ms tasks over 4 workers
+    };
+    auto load = [&](size_t i) {
+        return dispatch_load(peers[i].backlog_ms, peers[i].capacity, peers[i].expected_wait_ms);
+    };
+    size_t next = 0;
+    auto both = [&]() { return next++ % 2; };
+    bool ok = pick_greedy(2, load) == 1 && pick_power_of_d_sampled(2, both, load) == 1;
+    std::printf("peer load check: %s (queue %d vs %d, load %.0f vs %.0f ms)\n", ok ? "ok" : "FAILED",
+                peers[0].queue_length, peers[1].queue_length, load(0), load(1));
+    return ok;
+}
+
+SimResult simulate(const SimConfig& cfg, DispatchMode mode, int d) {
+    std::mt19937_64 rng(cfg.seed);
+    std::exponential_distribution<double> interarrival(cfg.load * cfg.nodes);
+    std::exponential_distribution<double> service(1.0);
+
+    // Completion times of tasks still in each node's system, oldest first
+    std::vector<std::deque<double>> in_system(cfg.nodes);
+    std::vector<size_t> reported(cfg.nodes, 0);
+    std::vector<double> waits;
+    waits.reserve(cfg.tasks);
+
+    SimResult result;
+    double now = 0.0;
+    double next_heartbeat = 0.0;
+
+    auto load = [&](size_t i) { return reported[i]; };
+
+    for (long t = 0; t < cfg.tasks; ++t) {
+        now += interarrival(rng);
+
+        for (auto& q : in_system) {
+            while (!q.empty() && q.front() <= now) q.pop_front();
+        }
+        if (now >= next_heartbeat) {
+            for (int i = 0; i < cfg.nodes; ++i) reported[i] = in_system[i].size();
+            next_heartbeat = now + cfg.period;
+        }
+
+        size_t target = pick_target(mode, cfg.nodes, d, rng, load);
+        auto& q = in_system[target];
+        double start = q.empty() ? now : std::max(now, q.back());
+        q.push_back(start + service(rng));
+
+        waits.push_back(start - now);
+        result.max_queue = std::max(result.max_queue, q.size());
+    }
+
+    std::sort(waits.begin(), waits.end());
+    double sum = 0.0;
+    for (double w : waits) sum += w;
+    result.mean_wait = sum / waits.size();
+    result.p50_wait = waits[waits.size() / 2];
+    result.p99_wait = waits[static_cast<size_t>(waits.size() * 0.99)];
+    return result;
+}
+
+int main(int argc, char** argv) {
+    SimConfig cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (eq == std::string::npos) continue;
+        std::string name = arg.substr(0, eq);
+        const char* value = arg.c_str() + eq + 1;
+        if (name == "--nodes") cfg.nodes = std::max(1, std::atoi(value));
+        else if (name == "--load") cfg.load = std::atof(value);
+        else if (name == "--tasks") cfg.tasks = std::max(1L, std::atol(value));
+        else if (name == "--period") cfg.period = std::atof(value);
+        else if (name == "--seed") cfg.seed = std::atoi(value);
+    }
+
+    if (!check_peer_load()) {
+        return 1;
+    }
+    std::printf("nodes=%d load=%.2f tasks=%ld heartbeat_period=%.2f\n",
+                cfg.nodes, cfg.load, cfg.tasks, cfg.period);
+    std::printf("%-10s %10s %10s %10s %10s\n", "policy", "max_queue", "mean_wait", "p50_wait", "p99_wait");
+
+    struct Policy { const char* name; DispatchMode mode; int d; };
+    const Policy policies[] = {
+        {"greedy", DispatchMode::GREEDY, 1},
+        {"random", DispatchMode::RANDOM, 1},
+        {"p2c", DispatchMode::POWER_OF_D, 2},
+        {"p3c", DispatchMode::POWER_OF_D, 3},
+    };
+    for (const auto& p : policies) {
+        SimResult r = simulate(cfg, p.mode, p.d);
+        std::printf("%-10s %10zu %10.3f %10.3f %10.3f\n",
+                    p.name, r.max_queue, r.mean_wait, r.p50_wait, r.p99_wait);
+    }
+    return 0;
+}
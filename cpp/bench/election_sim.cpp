@@ -0,0 +1,455 @@
+// Discrete-event simulation of heartbeats, elections and dispatch across
+// many nodes on a virtual clock. Each simulated node makes its decisions
+// with the code in node_logic.h that BasicNodeService runs: the same score
+// inputs and ScorePolicy, the same PeerScores election and expiry, and the
+// same heartbeat_targets rotation. Messages take a base latency plus
+// exponential jitter, and heartbeats can be lost. Task forwards are not
+// lost, as they go over a reliable call in the real node.
+//
+// Every node is a single FIFO server with exponential service times. Tasks
+// arrive as one Poisson stream at random live nodes; a node that believes
+// it is the leader dispatches them with the chosen mode, using the loads in
+// the heartbeats it has heard, and treats a peer it has not heard from as
+// infinitely loaded, like PeerLoad(). The same seed gives the same run.
+//
+// Usage: ./election_sim [--nodes=1000] [--seconds=120] [--heartbeat_ms=1000]
+//                       [--election_ms=5000] [--peer_timeout_ms=6000] [--fanout=100]
+//                       [--latency_ms=1] [--jitter_ms=2] [--loss=0.01]
+//                       [--rho=0.7] [--service_ms=20] [--dispatch=p2c] [--choices=2]
+//                       [--score=weighted|expected_wait|capacity|slo]
+//                       [--kill_leader_at=60] [--seed=1]
+#include "dispatch.h"
+#include "hdr_histogram.h"
+#include "node_logic.h"
+#include "score_index.h"
+#include "scoring.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct SimConfig {
+    int nodes = 1000;
+    int seconds = 120;
+    int heartbeat_ms = 1000;
+    int election_ms = 5000;
+    int peer_timeout_ms = 6000;
+    int fanout = 100;            // 0 sends every heartbeat to every node; see peer_expiry_ms
+    double latency_ms = 1.0;     // one way, before jitter
+    double jitter_ms = 2.0;      // mean of the exponential extra delay
+    double loss = 0.01;          // chance a heartbeat is dropped
+    double rho = 0.7;            // offered load / total capacity
+    double service_ms = 20.0;    // mean, exponential
+    DispatchMode dispatch = DispatchMode::POWER_OF_D;
+    int choices = 2;
+    double kill_leader_at = -1;  // seconds, < 0 never
+    unsigned seed = 1;
+};
+
+enum class EventType : uint8_t { HEARTBEAT, DELIVER, ELECTION, ARRIVAL, FORWARDED, COMPLETE, SAMPLE, KILL };
+
+struct Event {
+    int64_t at_us;
+    uint64_t seq;  // ties go in scheduling order, so runs repeat exactly
+    EventType type;
+    int node;
+    int from = -1;
+    float score = 0.0f;
+    float load = 0.0f;
+    double arrived_us = 0.0;
+
+    bool operator>(const Event& other) const {
+        return at_us != other.at_us ? at_us > other.at_us : seq > other.seq;
+    }
+};
+
+struct SimNode {
+    bool alive = true;
+    HostLoad host;                        // fixed background load
+    std::deque<double> queue;             // arrival times of waiting tasks, us
+    bool busy = false;
+    float score = 0.0f;                   // as of its last heartbeat
+    uint64_t round = 0;
+    int leader = -1;                      // as of its last election
+    PeerScores peers;
+    ScoreIndex peer_loads;                // negated, least loaded on top; greedy dispatch only
+    std::unordered_map<int, float> load_by_peer;
+    long completed = 0;
+};
+
+struct SimResult {
+    double wall_s = 0.0;
+    long events = 0;
+    long heartbeats = 0;
+    long lost = 0;
+    double first_agreement_s = -1.0;      // every live node names one live leader
+    double agreed_fraction = 0.0;         // of samples after that
+    double mean_majority = 0.0;           // share of nodes naming the most named leader
+    int leader_changes = 0;
+    double failover_ms = -1.0;
+    long completed = 0;
+    long forwarded = 0;
+    long dropped = 0;                     // queued on the killed node
+    double mean_wait_ms = 0.0;
+    double p99_wait_ms = 0.0;
+    double imbalance = 0.0;               // max / mean tasks completed per node
+};
+
+static std::string node_name(int i) {
+    return "n" + std::to_string(i);
+}
+
+static int node_index(const std::string& name) {
+    return std::atoi(name.c_str() + 1);
+}
+
+template <typename Policy>
+SimResult simulate(const SimConfig& cfg) {
+    auto wall_start = std::chrono::steady_clock::now();
+    std::mt19937_64 rng(cfg.seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::exponential_distribution<double> jitter(cfg.jitter_ms > 0 ? 1.0 / cfg.jitter_ms : 1.0);
+    std::exponential_distribution<double> service(1.0 / cfg.service_ms);
+    const double arrival_rate = cfg.rho * cfg.nodes / cfg.service_ms * 1000.0;  // per s
+    std::exponential_distribution<double> interarrival(arrival_rate > 0 ? arrival_rate : 1.0);
+
+    const int n = cfg.nodes;
+    const int64_t expiry_ms = peer_expiry_ms(cfg.peer_timeout_ms, n - 1, cfg.fanout);
+    std::vector<SimNode> nodes(n);
+    HdrHistogram waits(3600LL * 1000 * 1000, 2);  // us
+    double wait_total_us = 0.0;
+    std::vector<std::string> names;
+    for (int i = 0; i < n; ++i) {
+        names.push_back(node_name(i));
+        nodes[i].host.cpu_free = static_cast<float>(20.0 + 80.0 * unit(rng));
+        nodes[i].host.mem_free = static_cast<float>(20.0 + 80.0 * unit(rng));
+    }
+
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+    uint64_t seq = 0;
+    auto schedule = [&](Event e) {
+        e.seq = seq++;
+        events.push(e);
+    };
+    auto delay_us = [&]() {
+        double ms = cfg.latency_ms + (cfg.jitter_ms > 0 ? jitter(rng) : 0.0);
+        return static_cast<int64_t>(ms * 1000.0);
+    };
+    auto backlog_ms = [&](const SimNode& node) {
+        return static_cast<int64_t>((node.queue.size() + (node.busy ? 1 : 0)) * cfg.service_ms);
+    };
+    auto start_next = [&](int i, int64_t now_us) {
+        SimNode& node = nodes[i];
+        if (node.busy || node.queue.empty()) {
+            return;
+        }
+        int64_t wait_us = now_us - static_cast<int64_t>(node.queue.front());
+        waits.Record(wait_us);
+        wait_total_us += static_cast<double>(wait_us);
+        node.queue.pop_front();
+        node.busy = true;
+        schedule({now_us + static_cast<int64_t>(service(rng) * 1000.0), 0, EventType::COMPLETE, i});
+    };
+
+    // Nodes start at random phases, as real ones would
+    for (int i = 0; i < n; ++i) {
+        schedule({static_cast<int64_t>(unit(rng) * cfg.heartbeat_ms * 1000.0), 0, EventType::HEARTBEAT, i});
+        schedule({static_cast<int64_t>(unit(rng) * cfg.election_ms * 1000.0), 0, EventType::ELECTION, i});
+    }
+    if (arrival_rate > 0) {
+        schedule({static_cast<int64_t>(interarrival(rng) * 1e6), 0, EventType::ARRIVAL, -1});
+    }
+    schedule({100000, 0, EventType::SAMPLE, -1});
+    if (cfg.kill_leader_at >= 0) {
+        schedule({static_cast<int64_t>(cfg.kill_leader_at * 1e6), 0, EventType::KILL, -1});
+    }
+
+    SimResult result;
+    const int64_t end_us = static_cast<int64_t>(cfg.seconds) * 1000000;
+    int agreed_leader = -1;
+    int64_t killed_at_us = -1;
+    int killed = -1;
+    long samples = 0;
+    long agreed_samples = 0;
+    double majority_sum = 0.0;
+    std::vector<int> votes(n);
+
+    while (!events.empty() && events.top().at_us < end_us) {
+        Event e = events.top();
+        events.pop();
+        ++result.events;
+        const int64_t now_us = e.at_us;
+        const int64_t now_ms = now_us / 1000;
+
+        switch (e.type) {
+        case EventType::HEARTBEAT: {
+            SimNode& node = nodes[e.node];
+            if (!node.alive) {
+                break;
+            }
+            int64_t backlog = backlog_ms(node);
+            float queue = static_cast<float>(node.queue.size() + (node.busy ? 1 : 0));
+            node.score = Policy::Score(make_score_inputs(node.host, queue, backlog, static_cast<float>(backlog), 1));
+            for (size_t to : heartbeat_targets(names.size(), e.node, node.round++, cfg.fanout)) {
+                ++result.heartbeats;
+                if (unit(rng) < cfg.loss) {
+                    ++result.lost;
+                    continue;
+                }
+                Event msg{now_us + delay_us(), 0, EventType::DELIVER, static_cast<int>(to), e.node};
+                msg.score = node.score;
+                msg.load = static_cast<float>(backlog);
+                schedule(msg);
+            }
+            schedule({now_us + cfg.heartbeat_ms * 1000LL, 0, EventType::HEARTBEAT, e.node});
+            break;
+        }
+        case EventType::DELIVER: {
+            SimNode& node = nodes[e.node];
+            if (!node.alive) {
+                break;
+            }
+            node.peers.Heard(names[e.from], e.score, now_ms);
+            if (cfg.dispatch == DispatchMode::GREEDY) {
+                node.peer_loads.Update(names[e.from], -e.load);
+            }
+            node.load_by_peer[e.from] = e.load;
+            break;
+        }
+        case EventType::ELECTION: {
+            SimNode& node = nodes[e.node];
+            if (!node.alive) {
+                break;
+            }
+            for (const std::string& peer : node.peers.Expire(now_ms, expiry_ms)) {
+                node.peer_loads.Remove(peer);
+                node.load_by_peer.erase(node_index(peer));
+            }
+            node.leader = node_index(node.peers.Elect(names[e.node], node.score));
+            schedule({now_us + cfg.election_ms * 1000LL, 0, EventType::ELECTION, e.node});
+            break;
+        }
+        case EventType::ARRIVAL: {
+            schedule({now_us + static_cast<int64_t>(interarrival(rng) * 1e6), 0, EventType::ARRIVAL, -1});
+            int i = static_cast<int>(pick_random(n, rng));
+            if (!nodes[i].alive) {
+                break;  // the client retries elsewhere; not modelled
+            }
+            SimNode& node = nodes[i];
+            int target = i;
+            if (cfg.dispatch != DispatchMode::LOCAL && node.leader == i) {
+                auto load = [&](size_t j) {
+                    if (static_cast<int>(j) == i) {
+                        return static_cast<float>(backlog_ms(node));
+                    }
+                    auto it = node.load_by_peer.find(static_cast<int>(j));
+                    return it == node.load_by_peer.end() ? std::numeric_limits<float>::infinity() : it->second;
+                };
+                if (cfg.dispatch == DispatchMode::GREEDY) {
+                    if (!node.peer_loads.empty() && -node.peer_loads.TopScore() < load(i)) {
+                        target = node_index(node.peer_loads.TopNode());
+                    }
+                } else {
+                    auto sample = [&]() { return pick_random(n, rng); };
+                    target = static_cast<int>(pick_target_sampled(cfg.dispatch, n, cfg.choices, sample, load));
+                }
+                if (std::isinf(load(target))) {
+                    target = i;
+                }
+            }
+            if (target == i) {
+                node.queue.push_back(static_cast<double>(now_us));
+                start_next(i, now_us);
+            } else {
+                ++result.forwarded;
+                Event fwd{now_us + delay_us(), 0, EventType::FORWARDED, target, i};
+                fwd.arrived_us = static_cast<double>(now_us);
+                schedule(fwd);
+            }
+            break;
+        }
+        case EventType::FORWARDED: {
+            // A forward to a dead node fails and runs where it came from, like RequeueFailedForward
+            int i = nodes[e.node].alive ? e.node : e.from;
+            if (!nodes[i].alive) {
+                ++result.dropped;
+                break;
+            }
+            nodes[i].queue.push_back(e.arrived_us);
+            start_next(i, now_us);
+            break;
+        }
+        case EventType::COMPLETE: {
+            SimNode& node = nodes[e.node];
+            if (!node.alive) {
+                break;
+            }
+            node.busy = false;
+            ++node.completed;
+            ++result.completed;
+            start_next(e.node, now_us);
+            break;
+        }
+        case EventType::SAMPLE: {
+            schedule({now_us + 100000, 0, EventType::SAMPLE, -1});
+            std::fill(votes.begin(), votes.end(), 0);
+            int alive = 0;
+            int top = -1;
+            for (int i = 0; i < n; ++i) {
+                if (!nodes[i].alive || nodes[i].leader < 0) {
+                    alive += nodes[i].alive ? 1 : 0;
+                    continue;
+                }
+                ++alive;
+                int l = nodes[i].leader;
+                if (++votes[l] > (top < 0 ? 0 : votes[top])) {
+                    top = l;
+                }
+            }
+            if (top < 0 || alive == 0) {
+                break;
+            }
+            bool agreed = votes[top] == alive && nodes[top].alive;
+            if (agreed && result.first_agreement_s < 0) {
+                result.first_agreement_s = now_us / 1e6;
+            }
+            if (result.first_agreement_s >= 0) {
+                ++samples;
+                agreed_samples += agreed ? 1 : 0;
+                majority_sum += static_cast<double>(votes[top]) / alive;
+            }
+            if (agreed) {
+                if (agreed_leader >= 0 && top != agreed_leader) {
+                    ++result.leader_changes;
+                }
+                agreed_leader = top;
+                if (killed_at_us >= 0 && result.failover_ms < 0 && top != killed) {
+                    result.failover_ms = (now_us - killed_at_us) / 1000.0;
+                }
+            }
+            break;
+        }
+        case EventType::KILL: {
+            // The leader most nodes name
+            std::fill(votes.begin(), votes.end(), 0);
+            int top = -1;
+            for (const SimNode& node : nodes) {
+                if (node.alive && node.leader >= 0 && ++votes[node.leader] > (top < 0 ? 0 : votes[top])) {
+                    top = node.leader;
+                }
+            }
+            if (top >= 0) {
+                killed = top;
+                killed_at_us = now_us;
+                nodes[top].alive = false;
+                result.dropped += static_cast<long>(nodes[top].queue.size());
+                nodes[top].queue.clear();
+            }
+            break;
+        }
+        }
+    }
+
+    if (waits.TotalCount() > 0) {
+        result.mean_wait_ms = wait_total_us / waits.TotalCount() / 1000.0;
+        result.p99_wait_ms = waits.ValueAtPercentile(99.0) / 1000.0;
+    }
+    long most = 0;
+    for (const SimNode& node : nodes) most = std::max(most, node.completed);
+    double mean = static_cast<double>(result.completed) / n;
+    result.imbalance = mean > 0 ? most / mean : 0.0;
+    result.agreed_fraction = samples > 0 ? static_cast<double>(agreed_samples) / samples : 0.0;
+    result.mean_majority = samples > 0 ? majority_sum / samples : 0.0;
+    result.wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    return result;
+}
+
+static void print_result(const SimConfig& cfg, const SimResult& r) {
+    std::printf("simulated %ds in %.2fs (%.0fx real time), %ld events\n", cfg.seconds, r.wall_s,
+                cfg.seconds / std::max(r.wall_s, 1e-9), r.events);
+    std::printf("heartbeats %ld sent, %ld lost\n", r.heartbeats, r.lost);
+    if (r.first_agreement_s < 0) {
+        std::printf("election: live nodes never all agreed\n");
+    } else {
+        std::printf("election: first agreed at %.1fs, agreed in %.1f%% of samples after, "
+                    "mean majority %.1f%%, %d leader changes\n",
+                    r.first_agreement_s, 100.0 * r.agreed_fraction, 100.0 * r.mean_majority, r.leader_changes);
+    }
+    if (cfg.kill_leader_at >= 0) {
+        if (r.failover_ms < 0) {
+            std::printf("failover: none before the end\n");
+        } else {
+            std::printf("failover: %.0f ms\n", r.failover_ms);
+        }
+    }
+    std::printf("tasks: %ld completed, %ld forwarded, %ld dropped, wait mean %.1f ms p99 %.1f ms, "
+                "imbalance %.2f\n",
+                r.completed, r.forwarded, r.dropped, r.mean_wait_ms, r.p99_wait_ms, r.imbalance);
+}
+
+int main(int argc, char** argv) {
+    SimConfig cfg;
+    std::string score = WeightedSumPolicy::kName;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+        std::string name = arg.substr(2, eq - 2);
+        const char* value = arg.c_str() + eq + 1;
+        if (name == "nodes") cfg.nodes = std::max(1, std::atoi(value));
+        else if (name == "seconds") cfg.seconds = std::max(1, std::atoi(value));
+        else if (name == "heartbeat_ms") cfg.heartbeat_ms = std::max(1, std::atoi(value));
+        else if (name == "election_ms") cfg.election_ms = std::max(1, std::atoi(value));
+        else if (name == "peer_timeout_ms") cfg.peer_timeout_ms = std::max(0, std::atoi(value));
+        else if (name == "fanout") cfg.fanout = std::max(0, std::atoi(value));
+        else if (name == "latency_ms") cfg.latency_ms = std::max(0.0, std::atof(value));
+        else if (name == "jitter_ms") cfg.jitter_ms = std::max(0.0, std::atof(value));
+        else if (name == "loss") cfg.loss = std::clamp(std::atof(value), 0.0, 1.0);
+        else if (name == "rho") cfg.rho = std::max(0.0, std::atof(value));
+        else if (name == "service_ms") cfg.service_ms = std::max(0.001, std::atof(value));
+        else if (name == "choices") cfg.choices = std::max(1, std::atoi(value));
+        else if (name == "kill_leader_at") cfg.kill_leader_at = std::atof(value);
+        else if (name == "seed") cfg.seed = static_cast<unsigned>(std::atoi(value));
+        else if (name == "score") score = value;
+        else if (name == "dispatch") {
+            if (!parse_dispatch_mode(value, &cfg.dispatch)) {
+                std::fprintf(stderr, "Unknown dispatch mode: %s\n", value);
+                return 1;
+            }
+        } else {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    std::printf("%d nodes, heartbeat %d ms to %s, election %d ms, timeout %lld ms, "
+                "latency %.1f+%.1f ms, loss %.1f%%, %s dispatch, %s score\n",
+                cfg.nodes, cfg.heartbeat_ms, cfg.fanout > 0 ? (std::to_string(cfg.fanout) + " peers").c_str() : "all",
+                cfg.election_ms, static_cast<long long>(peer_expiry_ms(cfg.peer_timeout_ms, cfg.nodes - 1, cfg.fanout)),
+                cfg.latency_ms, cfg.jitter_ms, 100.0 * cfg.loss,
+                dispatch_mode_name(cfg.dispatch), score.c_str());
+    if (score == WeightedSumPolicy::kName) {
+        print_result(cfg, simulate<WeightedSumPolicy>(cfg));
+    } else if (score == ExpectedWaitPolicy::kName) {
+        print_result(cfg, simulate<ExpectedWaitPolicy>(cfg));
+    } else if (score == CapacityNormalizedPolicy::kName) {
+        print_result(cfg, simulate<CapacityNormalizedPolicy>(cfg));
+    } else if (score == DefaultSloPolicy::kName) {
+        print_result(cfg, simulate<DefaultSloPolicy>(cfg));
+    } else {
+        std::fprintf(stderr, "Unknown scoring policy: %s\n", score.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+// Checks the routing_key hash ring: how many keys move when a node joins or
+// leaves, and how evenly bounded-load placement spreads skewed keys.
+//
+// Usage: ./hash_ring_sim [--nodes=50] [--keys=200000] [--vnodes=128] [--factor=1.25]
+#include "hash_ring.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static std::string node_name(int i) {
+    return "node-" + std::to_string(i) + ":50051";
+}
+
+static double moved_fraction(const HashRing& before, const HashRing& after, int keys) {
+    int moved = 0;
+    for (int k = 0; k < keys; ++k) {
+        std::string key = "key-" + std::to_string(k);
+        if (before.Owner(key) != after.Owner(key)) ++moved;
+    }
+    return static_cast<double>(moved) / keys;
+}
+
+int main(int argc, char** argv) {
+    int nodes = 50;
+    int keys = 200000;
+    int vnodes = 128;
+    double factor = 1.25;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (eq == std::string::npos) continue;
+        std::string name = arg.substr(0, eq);
+        const char* value = arg.c_str() + eq + 1;
+        if (name == "--nodes") nodes = std::atoi(value);
+        else if (name == "--keys") keys = std::atoi(value);
+        else if (name == "--vnodes") vnodes = std::atoi(value);
+        else if (name == "--factor") factor = std::atof(value);
+    }
+
+    HashRing ring(vnodes);
+    for (int i = 0; i < nodes; ++i) ring.AddNode(node_name(i));
+
+    HashRing grown = ring;
+    grown.AddNode(node_name(nodes));
+    HashRing shrunk = ring;
+    shrunk.RemoveNode(node_name(0));
+
+    std::printf("nodes=%d keys=%d vnodes=%d\n", nodes, keys, vnodes);
+    std::printf("join:  %.4f of keys moved (ideal %.4f)\n", moved_fraction(ring, grown, keys), 1.0 / (nodes + 1));
+    std::printf("leave: %.4f of keys moved (ideal %.4f)\n", moved_fraction(ring, shrunk, keys), 1.0 / nodes);
+
+    // Place Zipf-skewed requests, with and without the load bound
+    std::mt19937_64 rng(1);
+    std::vector<double> weights(keys);
+    for (int k = 0; k < keys; ++k) weights[k] = 1.0 / std::pow(k + 1, 1.1);
+    std::discrete_distribution<int> zipf(weights.begin(), weights.end());
+
+    const int requests = 200000;
+    std::unordered_map<std::string, int> plain, bounded;
+    for (int r = 0; r < requests; ++r) {
+        std::string key = "key-" + std::to_string(zipf(rng));
+        ++plain[ring.Owner(key)];
+        double max_load = factor * (static_cast<double>(r) / nodes) + 1.0;
+        ++bounded[ring.BoundedOwner(key, max_load, [&](const std::string& n) {
+            auto it = bounded.find(n);
+            return it == bounded.end() ? 0 : it->second;
+        })];
+    }
+
+    auto max_of = [](const std::unordered_map<std::string, int>& m) {
+        int best = 0;
+        for (const auto& [n, c] : m) best = std::max(best, c);
+        return best;
+    };
+    double mean = static_cast<double>(requests) / nodes;
+    std::printf("zipf placement: max/mean load %.2f plain, %.2f bounded (factor %.2f)\n",
+                max_of(plain) / mean, max_of(bounded) / mean, factor);
+    return 0;
+}
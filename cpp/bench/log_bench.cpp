@@ -0,0 +1,74 @@
+// Cost to the calling thread of one log line through LOG_INFO versus
+// std::cout, with several threads logging at once. Run with stdout sent
+// somewhere cheap so the terminal is not what gets measured; results go
+// to stderr.
+//
+// Usage: ./log_bench [--threads=8] [--lines=200000] > /dev/null
+#include "log.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Fn>
+double ns_per_line(int threads, long lines, Fn log_line) {
+    auto start = Clock::now();
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            for (long i = 0; i < lines; ++i) log_line(t, i);
+        });
+    }
+    for (auto& th : pool) th.join();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return ns / lines;  // wall time per line on each thread
+}
+
+int main(int argc, char** argv) {
+    int threads = 8;
+    long lines = 200000;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (eq == std::string::npos) continue;
+        std::string name = arg.substr(0, eq);
+        const char* value = arg.c_str() + eq + 1;
+        if (name == "--threads") threads = std::max(1, std::atoi(value));
+        else if (name == "--lines") lines = std::atol(value);
+    }
+    const std::string peer = "localhost:50052";
+
+    double cout_ns = ns_per_line(threads, lines, [&](int t, long i) {
+        std::cout << "[TASK RECEIVED] Task ID: " << i << " from " << peer << " on " << t << "\n";
+    });
+    std::cout.flush();
+
+    double log_ns = ns_per_line(threads, lines, [&](int t, long i) {
+        LOG_INFO("TASK RECEIVED", "Task ID: {} from {} on {}", i, peer, t);
+    });
+    log_flush();
+
+    set_log_sample_every(100);
+    double sampled_ns = ns_per_line(threads, lines, [&](int t, long i) {
+        LOG_SAMPLED(LogLevel::INFO, "TASK RECEIVED", "Task ID: {} from {} on {}", i, peer, t);
+    });
+    log_flush();
+
+    set_log_level(LogLevel::WARN);
+    double disabled_ns = ns_per_line(threads, lines, [&](int t, long i) {
+        LOG_INFO("TASK RECEIVED", "Task ID: {} from {} on {}", i, peer, t);
+    });
+
+    std::fprintf(stderr, "threads=%d lines=%ld per thread\n", threads, lines);
+    std::fprintf(stderr, "%-16s %10s\n", "sink", "ns/line");
+    std::fprintf(stderr, "%-16s %10.1f\n", "std::cout", cout_ns);
+    std::fprintf(stderr, "%-16s %10.1f\n", "LOG_INFO", log_ns);
+    std::fprintf(stderr, "%-16s %10.1f\n", "LOG_SAMPLED/100", sampled_ns);
+    std::fprintf(stderr, "%-16s %10.1f\n", "below level", disabled_ns);
+    return 0;
+}
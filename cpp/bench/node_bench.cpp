@@ -0,0 +1,255 @@
+// Microbenchmarks of the node's hot paths: the task queue under contention,
+// score computation, message encoding, the peer score index behind
+// elections, and AssignTask / Heartbeat round trips through an in-process
+// gRPC channel (the full handler, without the network).
+//
+// Usage: ./node_bench [--benchmark_filter=regex]
+//                     [--benchmark_out=results.json --benchmark_out_format=json]
+// Compare two runs with tools/compare.py from Google Benchmark.
+#include "lock_profile.h"
+#include "log.h"
+#include "node_server.h"
+#include "score_index.h"
+#include "scoring.h"
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Same shape as EnqueueLocked / ProcessTasks: every thread pushes one task and
+// pops one, under one ProfiledMutex. Arg is the lock profile sampling, 0 off.
+static std::deque<QueuedTask> g_queue;
+static ProfiledMutex g_queue_mutex{"bench_queue"};
+
+static void BM_QueuePushPop(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        set_lock_profile_sample(static_cast<int>(state.range(0)));
+    }
+    leader::Task task;
+    task.set_task_id(state.thread_index());
+    task.set_duration_ms(10);
+    for (auto _ : state) {
+        {
+            PROFILED_LOCK(lock, g_queue_mutex, "bench push");
+            g_queue.push_back({task, std::chrono::steady_clock::now()});
+        }
+        PROFILED_LOCK(lock, g_queue_mutex, "bench pop");
+        if (!g_queue.empty()) {
+            benchmark::DoNotOptimize(g_queue.front());
+            g_queue.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_QueuePushPop)->Arg(0)->Arg(64)->ThreadRange(1, 8)->UseRealTime();
+
+template <typename Policy>
+static void BM_Score(benchmark::State& state) {
+    ScoreInputs in;
+    in.host = current_host_load();
+    in.queue_length = 3.0f;
+    in.backlog_ms = 120.0f;
+    in.expected_wait_ms = 40.0f;
+    in.capacity = 4.0f;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(in);
+        benchmark::DoNotOptimize(Policy::Score(in));
+    }
+}
+BENCHMARK_TEMPLATE(BM_Score, WeightedSumPolicy);
+BENCHMARK_TEMPLATE(BM_Score, ExpectedWaitPolicy);
+BENCHMARK_TEMPLATE(BM_Score, CapacityNormalizedPolicy);
+BENCHMARK_TEMPLATE(BM_Score, DefaultSloPolicy);
+
+// What the heartbeat path reads before scoring
+static void BM_CurrentHostLoad(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(current_host_load());
+    }
+}
+BENCHMARK(BM_CurrentHostLoad);
+
+static leader::Task make_task() {
+    leader::Task task;
+    task.set_task_id(123456);
+    task.set_duration_ms(25);
+    task.set_routing_key("tenant-42/object-1337");
+    task.set_priority(1);
+    task.set_received_us(1700000000000000);
+    task.set_trace_id(0x1234567890abcdefULL);
+    return task;
+}
+
+static leader::NodeStatus make_status() {
+    leader::NodeStatus status;
+    status.set_node_id("10.0.0.17:50051");
+    status.set_score(0.73f);
+    status.set_queue_length(12);
+    status.set_backlog_ms(480);
+    status.set_capacity(8);
+    return status;
+}
+
+template <typename Message>
+static void bench_serialize(benchmark::State& state, const Message& message) {
+    std::string out;
+    for (auto _ : state) {
+        message.SerializeToString(&out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(out.size()));
+}
+
+template <typename Message>
+static void bench_parse(benchmark::State& state, const Message& message) {
+    std::string bytes = message.SerializeAsString();
+    Message parsed;
+    for (auto _ : state) {
+        parsed.ParseFromString(bytes);
+        benchmark::DoNotOptimize(parsed);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+
+static void BM_TaskSerialize(benchmark::State& state) { bench_serialize(state, make_task()); }
+static void BM_TaskParse(benchmark::State& state) { bench_parse(state, make_task()); }
+static void BM_NodeStatusSerialize(benchmark::State& state) { bench_serialize(state, make_status()); }
+static void BM_NodeStatusParse(benchmark::State& state) { bench_parse(state, make_status()); }
+BENCHMARK(BM_TaskSerialize);
+BENCHMARK(BM_TaskParse);
+BENCHMARK(BM_NodeStatusSerialize);
+BENCHMARK(BM_NodeStatusParse);
+
+static std::vector<std::string> peer_names(int n) {
+    std::vector<std::string> names;
+    for (int i = 0; i < n; ++i) {
+        names.push_back("10.0." + std::to_string(i / 256) + "." + std::to_string(i % 256) + ":50051");
+    }
+    return names;
+}
+
+// One heartbeat's worth of work on peer_scores_, with Arg peers known
+static void BM_PeerScoreUpdate(benchmark::State& state) {
+    std::vector<std::string> names = peer_names(static_cast<int>(state.range(0)));
+    ScoreIndex index;
+    for (size_t i = 0; i < names.size(); ++i) {
+        index.Update(names[i], static_cast<float>(i));
+    }
+    size_t i = 0;
+    float score = 0.0f;
+    for (auto _ : state) {
+        index.Update(names[i], score);
+        i = i + 1 == names.size() ? 0 : i + 1;
+        score += 0.37f;
+    }
+}
+BENCHMARK(BM_PeerScoreUpdate)->RangeMultiplier(10)->Range(10, 10000);
+
+// ElectionLoop's pick against the index, and the linear scan it replaced
+static void BM_ElectionScan(benchmark::State& state) {
+    std::vector<std::string> names = peer_names(static_cast<int>(state.range(0)));
+    ScoreIndex index;
+    for (size_t i = 0; i < names.size(); ++i) {
+        index.Update(names[i], static_cast<float>((i * 7919) % names.size()));
+    }
+    float my_score = 0.5f;
+    for (auto _ : state) {
+        const std::string* best = nullptr;
+        if (!index.empty() && index.TopScore() > my_score) {
+            best = &index.TopNode();
+        }
+        benchmark::DoNotOptimize(best);
+    }
+}
+BENCHMARK(BM_ElectionScan)->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_ElectionLinearScan(benchmark::State& state) {
+    std::vector<std::string> names = peer_names(static_cast<int>(state.range(0)));
+    std::unordered_map<std::string, float> scores;
+    for (size_t i = 0; i < names.size(); ++i) {
+        scores[names[i]] = static_cast<float>((i * 7919) % names.size());
+    }
+    for (auto _ : state) {
+        const std::string* best = nullptr;
+        float best_score = 0.5f;
+        for (const auto& [node, score] : scores) {
+            if (score > best_score) {
+                best = &node;
+                best_score = score;
+            }
+        }
+        benchmark::DoNotOptimize(best);
+    }
+}
+BENCHMARK(BM_ElectionLinearScan)->RangeMultiplier(10)->Range(10, 10000);
+
+// A node served on an in-process channel. Nothing runs the queue, so
+// AssignTask measures receive and enqueue only.
+class InProcessNode {
+public:
+    InProcessNode() : service_("bench:0") {
+        grpc::ServerBuilder builder;
+        builder.RegisterService(&service_);
+        server_ = builder.BuildAndStart();
+        stub_ = leader::NodeService::NewStub(server_->InProcessChannel(grpc::ChannelArguments()));
+    }
+    ~InProcessNode() { server_->Shutdown(); }
+
+    leader::NodeService::Stub& stub() { return *stub_; }
+
+private:
+    NodeServiceImpl service_;
+    std::unique_ptr<grpc::Server> server_;
+    std::unique_ptr<leader::NodeService::Stub> stub_;
+};
+
+static void BM_AssignTaskRoundTrip(benchmark::State& state) {
+    InProcessNode node;
+    leader::Task task = make_task();
+    leader::Ack ack;
+    for (auto _ : state) {
+        grpc::ClientContext context;
+        grpc::Status s = node.stub().AssignTask(&context, task, &ack);
+        if (!s.ok()) {
+            state.SkipWithError(s.error_message().c_str());
+            break;
+        }
+        task.set_task_id(task.task_id() + 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AssignTaskRoundTrip)->UseRealTime();
+
+static void BM_HeartbeatRoundTrip(benchmark::State& state) {
+    InProcessNode node;
+    std::vector<std::string> names = peer_names(100);
+    leader::NodeStatus status = make_status();
+    leader::Ack ack;
+    size_t i = 0;
+    for (auto _ : state) {
+        status.set_node_id(names[i]);
+        i = i + 1 == names.size() ? 0 : i + 1;
+        grpc::ClientContext context;
+        grpc::Status s = node.stub().Heartbeat(&context, status, &ack);
+        if (!s.ok()) {
+            state.SkipWithError(s.error_message().c_str());
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HeartbeatRoundTrip)->UseRealTime();
+
+// The handlers log at INFO; keep that out of the timings and the output
+int main(int argc, char** argv) {
+    set_log_level(LogLevel::WARN);
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Compares ScoreIndex against the linear scan of an unordered_map that
+// ElectionLoop used to do, for a stream of heartbeat updates mixed with
+// best-node and top-k reads.
+//
+// Usage: ./score_index_bench [--peers=10000] [--ops=200000] [--k=8]
+#include "score_index.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double ns_per_op(Clock::time_point start, long ops) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ops;
+}
+
+int main(int argc, char** argv) {
+    int peers = 10000;
+    long ops = 200000;
+    size_t k = 8;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (eq == std::string::npos) continue;
+        std::string name = arg.substr(0, eq);
+        const char* value = arg.c_str() + eq + 1;
+        if (name == "--peers") peers = std::atoi(value);
+        else if (name == "--ops") ops = std::atol(value);
+        else if (name == "--k") k = std::atoi(value);
+    }
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> score(0.0f, 100.0f);
+    std::vector<std::string> names;
+    for (int i = 0; i < peers; ++i) names.push_back("10.0." + std::to_string(i / 256) + "." + std::to_string(i % 256) + ":50051");
+
+    std::unordered_map<std::string, float> scores;
+    ScoreIndex index;
+    for (const auto& n : names) {
+        float s = score(rng);
+        scores[n] = s;
+        index.Update(n, s);
+    }
+
+    // Same update stream for both
+    std::vector<std::pair<int, float>> updates(ops);
+    for (auto& u : updates) u = {static_cast<int>(rng() % peers), score(rng)};
+
+    float sink = 0.0f;
+    long mismatches = 0;
+
+    auto start = Clock::now();
+    for (const auto& [i, s] : updates) scores[names[i]] = s;
+    double map_update = ns_per_op(start, ops);
+
+    start = Clock::now();
+    for (const auto& [i, s] : updates) index.Update(names[i], s);
+    double index_update = ns_per_op(start, ops);
+
+    const long reads = std::max(1L, ops / 100);
+    start = Clock::now();
+    for (long r = 0; r < reads; ++r) {
+        float best = -1.0f;
+        for (const auto& [node, s] : scores) best = std::max(best, s);
+        sink += best;
+    }
+    double scan_best = ns_per_op(start, reads);
+
+    start = Clock::now();
+    for (long r = 0; r < reads; ++r) sink += index.TopScore();
+    double index_best = ns_per_op(start, reads);
+
+    start = Clock::now();
+    std::vector<float> all;
+    for (long r = 0; r < reads; ++r) {
+        all.clear();
+        for (const auto& [node, s] : scores) all.push_back(s);
+        std::partial_sort(all.begin(), all.begin() + std::min(k, all.size()), all.end(), std::greater<float>());
+        sink += all[0];
+    }
+    double scan_topk = ns_per_op(start, reads);
+
+    start = Clock::now();
+    for (long r = 0; r < reads; ++r) sink += index.TopK(k)[0].second;
+    double index_topk = ns_per_op(start, reads);
+
+    // The index must agree with the scan
+    auto top = index.TopK(k);
+    for (size_t j = 0; j < top.size(); ++j) {
+        if (top[j].second != all[j] || scores[top[j].first] != top[j].second) ++mismatches;
+    }
+
+    // One decision per heartbeat: the pattern ElectionLoop plus a dispatcher sees
+    start = Clock::now();
+    for (long r = 0; r < reads; ++r) {
+        scores[names[updates[r].first]] = updates[r].second;
+        float best = -1.0f;
+        for (const auto& [node, v] : scores) best = std::max(best, v);
+        sink += best;
+    }
+    double scan_mixed = ns_per_op(start, reads);
+
+    start = Clock::now();
+    for (const auto& [i, s] : updates) {
+        index.Update(names[i], s);
+        sink += index.TopScore();
+    }
+    double index_mixed = ns_per_op(start, ops);
+
+    std::printf("peers=%d ops=%ld k=%zu\n", peers, ops, k);
+    std::printf("%-28s %14s %14s\n", "operation (ns/op)", "linear scan", "ScoreIndex");
+    std::printf("%-28s %14.1f %14.1f\n", "heartbeat update", map_update, index_update);
+    std::printf("%-28s %14.1f %14.1f\n", "best node", scan_best, index_best);
+    std::printf("%-28s %14.1f %14.1f\n", "top-k", scan_topk, index_topk);
+    std::printf("%-28s %14.1f %14.1f\n", "update + best node", scan_mixed, index_mixed);
+    std::printf("mismatches=%ld (checksum %.1f)\n", mismatches, sink);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+// Runs each scoring policy in scoring.h over the same simulated cluster of
+// nodes with different numbers of servers. The policy only decides
+// elections: dispatch is power-of-two-choices on the load each node last
+// advertised, max(backlog per server, expected wait), as PeerLoad() does
+// whatever the policy, with candidates drawn uniformly or in proportion to
+// capacity. Every heartbeat, each policy scores the same node states and
+// elects its own leader, as in ElectionLoop, so the policies differ only in
+// who leads, how often that changes and how busy the leader is. Policies
+// are template arguments, the same way BasicNodeService takes them.
+//
+// Usage: ./scoring_bench [--nodes=50] [--rho=0.85] [--service_ms=20]
+//                        [--heartbeat_ms=2000] [--seconds=120] [--seed=1]
+#include "dispatch.h"
+#include "scoring.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Config {
+    int nodes = 50;
+    double rho = 0.85;          // offered load / total capacity
+    double service_ms = 20.0;   // mean, exponential
+    int heartbeat_ms = 2000;
+    int seconds = 120;
+    unsigned seed = 1;
+};
+
+struct Policy {
+    const char* name;
+    float (*score)(const ScoreInputs&);
+};
+
+template <typename P>
+Policy policy() {
+    return {P::kName, &P::Score};
+}
+
+// The same for every policy
+struct DispatchResult {
+    double mean_wait = 0.0;
+    double p99_wait = 0.0;
+    double imbalance = 0.0;     // max / mean utilisation
+};
+
+struct ElectionResult {
+    int leader = -1;
+    int leader_changes = 0;
+    double leader_busy = 0.0;   // sum over ms of the leader's utilisation
+};
+
+struct SimNode {
+    int servers = 1;
+    std::vector<double> remaining;  // per busy server
+    std::deque<std::pair<double, double>> queue;  // arrival time, service ms
+    double busy_ms = 0.0;
+    float load = 0.0f;              // as of last heartbeat, lower is better
+};
+
+// 1 in 2 nodes has 1 server, 1 in 4 has 4 and 1 in 4 has 8
+static int servers_for(int i) {
+    static const int kServers[] = {1, 4, 1, 8};
+    return kServers[i % 4];
+}
+
+static DispatchResult run(const Config& cfg, bool by_capacity, const std::vector<Policy>& policies,
+                          std::vector<ElectionResult>* elections) {
+    std::mt19937 rng(cfg.seed);
+    std::vector<SimNode> nodes(cfg.nodes);
+    int total_servers = 0;
+    std::vector<double> weights;
+    for (int i = 0; i < cfg.nodes; ++i) {
+        nodes[i].servers = servers_for(i);
+        total_servers += nodes[i].servers;
+        weights.push_back(by_capacity ? nodes[i].servers : 1.0);
+    }
+    WeightedSampler sampler;
+    sampler.Assign(weights);
+
+    double rate_per_ms = cfg.rho * total_servers / cfg.service_ms;
+    std::poisson_distribution<int> arrivals(rate_per_ms);
+    std::exponential_distribution<double> service(1.0 / cfg.service_ms);
+
+    std::vector<double> waits;
+    elections->assign(policies.size(), ElectionResult{});
+    std::vector<float> scores(cfg.nodes);
+
+    const int end_ms = cfg.seconds * 1000;
+    for (int now = 0; now < end_ms; ++now) {
+        if (now % cfg.heartbeat_ms == 0) {
+            std::vector<ScoreInputs> inputs(cfg.nodes);
+            for (int i = 0; i < cfg.nodes; ++i) {
+                SimNode& n = nodes[i];
+                ScoreInputs& in = inputs[i];
+                double work = 0.0;
+                for (double r : n.remaining) work += r;
+                for (const auto& q : n.queue) work += q.second;
+                in.host.cpu_free = 100.0f * (1.0f - static_cast<float>(n.remaining.size()) / n.servers);
+                in.queue_length = static_cast<float>(n.queue.size());
+                in.backlog_ms = static_cast<float>(work / n.servers);
+                in.expected_wait_ms = static_cast<float>(n.queue.size() * cfg.service_ms / n.servers);
+                in.capacity = static_cast<float>(n.servers);
+                n.load = std::max(in.backlog_ms, in.expected_wait_ms);
+            }
+            for (size_t p = 0; p < policies.size(); ++p) {
+                int best = 0;
+                for (int i = 0; i < cfg.nodes; ++i) {
+                    scores[i] = policies[p].score(inputs[i]);
+                    if (scores[i] > scores[best]) best = i;
+                }
+                ElectionResult& e = (*elections)[p];
+                if (e.leader != -1 && best != e.leader) ++e.leader_changes;
+                e.leader = best;
+            }
+        }
+
+        for (int k = arrivals(rng); k > 0; --k) {
+            size_t target = pick_power_of_d_sampled(2, [&]() { return sampler.Sample(rng); },
+                                                    [&](size_t i) { return nodes[i].load; });
+            nodes[target].queue.emplace_back(now, service(rng));
+        }
+
+        for (SimNode& n : nodes) {
+            while (static_cast<int>(n.remaining.size()) < n.servers && !n.queue.empty()) {
+                waits.push_back(now - n.queue.front().first);
+                n.remaining.push_back(n.queue.front().second);
+                n.queue.pop_front();
+            }
+            n.busy_ms += n.remaining.size();
+            for (double& r : n.remaining) r -= 1.0;
+            n.remaining.erase(std::remove_if(n.remaining.begin(), n.remaining.end(),
+                                             [](double r) { return r <= 0.0; }),
+                              n.remaining.end());
+        }
+        for (ElectionResult& e : *elections) {
+            const SimNode& l = nodes[e.leader];
+            e.leader_busy += static_cast<double>(l.remaining.size()) / l.servers;
+        }
+    }
+
+    DispatchResult result;
+    if (!waits.empty()) {
+        double sum = 0.0;
+        for (double w : waits) sum += w;
+        result.mean_wait = sum / waits.size();
+        size_t p99 = waits.size() * 99 / 100;
+        std::nth_element(waits.begin(), waits.begin() + p99, waits.end());
+        result.p99_wait = waits[p99];
+    }
+    double max_util = 0.0, sum_util = 0.0;
+    for (const SimNode& n : nodes) {
+        double util = n.busy_ms / (static_cast<double>(end_ms) * n.servers);
+        max_util = std::max(max_util, util);
+        sum_util += util;
+    }
+    result.imbalance = sum_util > 0.0 ? max_util * cfg.nodes / sum_util : 0.0;
+    for (ElectionResult& e : *elections) {
+        e.leader_busy /= end_ms;
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    Config cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (eq == std::string::npos) continue;
+        std::string name = arg.substr(0, eq);
+        const char* value = arg.c_str() + eq + 1;
+        if (name == "--nodes") cfg.nodes = std::max(1, std::atoi(value));
+        else if (name == "--rho") cfg.rho = std::atof(value);
+        else if (name == "--service_ms") cfg.service_ms = std::atof(value);
+        else if (name == "--heartbeat_ms") cfg.heartbeat_ms = std::max(1, std::atoi(value));
+        else if (name == "--seconds") cfg.seconds = std::max(1, std::atoi(value));
+        else if (name == "--seed") cfg.seed = std::atoi(value);
+    }
+
+    const std::vector<Policy> policies = {policy<WeightedSumPolicy>(), policy<ExpectedWaitPolicy>(),
+                                          policy<CapacityNormalizedPolicy>(), policy<DefaultSloPolicy>()};
+    printf("nodes=%d rho=%.2f service_ms=%.0f heartbeat_ms=%d seconds=%d\n",
+           cfg.nodes, cfg.rho, cfg.service_ms, cfg.heartbeat_ms, cfg.seconds);
+    for (bool by_capacity : {false, true}) {
+        std::vector<ElectionResult> elections;
+        DispatchResult d = run(cfg, by_capacity, policies, &elections);
+        printf("\n%s sampling: dispatch mean %.1f ms, p99 %.1f ms, imbalance %.2f\n",
+               by_capacity ? "capacity" : "uniform", d.mean_wait, d.p99_wait, d.imbalance);
+        printf("%-14s %8s %12s\n", "policy", "changes", "leader_util");
+        for (size_t p = 0; p < policies.size(); ++p) {
+            printf("%-14s %8d %12.2f\n", policies[p].name, elections[p].leader_changes, elections[p].leader_busy);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include "dispatch.h"
+
+bool parse_dispatch_mode(const std::string& name, DispatchMode* mode) {
+    if (name == "local") {
+        *mode = DispatchMode::LOCAL;
+    } else if (name == "greedy") {
+        *mode = DispatchMode::GREEDY;
+    } else if (name == "random") {
+        *mode = DispatchMode::RANDOM;
+    } else if (name == "p2c" || name == "power_of_d") {
+        *mode = DispatchMode::POWER_OF_D;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* dispatch_mode_name(DispatchMode mode) {
+    switch (mode) {
+        case DispatchMode::LOCAL:      return "local";
+        case DispatchMode::GREEDY:     return "greedy";
+        case DispatchMode::RANDOM:     return "random";
+        case DispatchMode::POWER_OF_D: return "p2c";
+    }
+    return "unknown";
+}
+
+void WeightedSampler::Assign(const std::vector<double>& weights) {
+    cumulative_.resize(weights.size());
+    double total = 0.0;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        total += std::max(0.0, weights[i]);
+        cumulative_[i] = total;
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+enum class DispatchMode {
+    LOCAL,       // keep every task on the node that received it
+    GREEDY,      // send to the least loaded node
+    RANDOM,      // send to a uniformly random node
+    POWER_OF_D   // sample d nodes, send to the least loaded of them
+};
+
+bool parse_dispatch_mode(const std::string& name, DispatchMode* mode);
+const char* dispatch_mode_name(DispatchMode mode);
+
+// The pickers below return an index in [0, n). load(i) is lower-is-better.
+
+template <typename LoadFn>
+size_t pick_greedy(size_t n, LoadFn load) {
+    size_t best = 0;
+    auto best_load = load(0);
+    for (size_t i = 1; i < n; ++i) {
+        auto l = load(i);
+        if (l < best_load) {
+            best = i;
+            best_load = l;
+        }
+    }
+    return best;
+}
+
+template <typename Rng>
+size_t pick_random(size_t n, Rng& rng) {
+    return std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+}
+
+// Draws index i with probability weight[i] / sum of weights, in O(log n).
+// Used to sample nodes in proportion to their capacity.
+class WeightedSampler {
+public:
+    // Non-positive weights are never drawn; if all are, draws are uniform
+    void Assign(const std::vector<double>& weights);
+
+    size_t size() const { return cumulative_.size(); }
+
+    template <typename Rng>
+    size_t Sample(Rng& rng) const {
+        if (cumulative_.empty() || cumulative_.back() <= 0.0) {
+            return pick_random(cumulative_.size(), rng);
+        }
+        double x = std::uniform_real_distribution<double>(0.0, cumulative_.back())(rng);
+        auto it = std::upper_bound(cumulative_.begin(), cumulative_.end(), x);
+        return std::min<size_t>(it - cumulative_.begin(), cumulative_.size() - 1);
+    }
+
+private:
+    std::vector<double> cumulative_;
+};
+
+// Samples d nodes (with replacement) using sample() and keeps the least
+// loaded one, so the cost is O(d) no matter how many nodes there are.
+template <typename LoadFn, typename SampleFn>
+size_t pick_power_of_d_sampled(int d, SampleFn sample, LoadFn load) {
+    size_t best = sample();
+    auto best_load = load(best);
+    for (int k = 1; k < d; ++k) {
+        size_t i = sample();
+        auto l = load(i);
+        if (l < best_load) {
+            best = i;
+            best_load = l;
+        }
+    }
+    return best;
+}
+
+template <typename LoadFn, typename Rng>
+size_t pick_power_of_d(size_t n, int d, Rng& rng, LoadFn load) {
+    return pick_power_of_d_sampled(d, [&]() { return pick_random(n, rng); }, load);
+}
+
+// RANDOM and POWER_OF_D draw candidates with sample()
+template <typename LoadFn, typename SampleFn>
+size_t pick_target_sampled(DispatchMode mode, size_t n, int d, SampleFn sample, LoadFn load) {
+    switch (mode) {
+        case DispatchMode::GREEDY:
+            return pick_greedy(n, load);
+        case DispatchMode::RANDOM:
+            return sample();
+        case DispatchMode::POWER_OF_D:
+            return pick_power_of_d_sampled(d, sample, load);
+        case DispatchMode::LOCAL:
+            break;
+    }
+    return 0;
+}
+
+template <typename LoadFn, typename Rng>
+size_t pick_target(DispatchMode mode, size_t n, int d, Rng& rng, LoadFn load) {
+    return pick_target_sampled(mode, n, d, [&]() { return pick_random(n, rng); }, load);
+}
+
+#endif // DISPATCH_H
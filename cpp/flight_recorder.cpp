@@ -0,0 +1,293 @@
+#include "flight_recorder.h"
+#include <algorithm>
+#include <csignal>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace flight_internal {
+
+Ring g_rings[kFlightRings];
+
+namespace {
+
+// Hands the thread's ring back when the thread exits
+struct RingOwner {
+    Ring* ring = nullptr;
+    ~RingOwner() {
+        if (ring) {
+            t_ring = nullptr;
+            ring->owned.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local RingOwner t_owner;
+
+}  // namespace
+
+Ring* claim_ring() {
+    // A thread that found every ring owned looks again on each event, so it
+    // starts recording once some other thread exits
+    for (Ring& ring : g_rings) {
+        bool expected = false;
+        if (!ring.owned.load(std::memory_order_relaxed) &&
+            ring.owned.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            t_owner.ring = &ring;
+            t_ring = &ring;
+            return t_ring;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace flight_internal
+
+namespace {
+
+using flight_internal::Event;
+using flight_internal::g_rings;
+
+// How each event's a, b and c are printed
+enum class Format : uint8_t { NONE, INT, HEX, MILLI };
+
+struct EventFormat {
+    const char* name;
+    const char* keys[3];
+    Format formats[3];
+    const char* text_key;
+};
+
+const EventFormat kFormats[] = {
+    {"ENQUEUE", {"task", "queue", "trace"}, {Format::INT, Format::INT, Format::HEX}, nullptr},
+    {"DEQUEUE", {"task", "queued_us", "queue"}, {Format::INT, Format::INT, Format::INT}, nullptr},
+    {"DONE", {"task", "run_us", nullptr}, {Format::INT, Format::INT, Format::NONE}, nullptr},
+    {"FORWARD", {"task", nullptr, "trace"}, {Format::INT, Format::NONE, Format::HEX}, "to"},
+    {"HEARTBEAT_SEND", {"ok", "rtt_us", "score"}, {Format::INT, Format::INT, Format::MILLI}, "peer"},
+    {"HEARTBEAT_RECV", {"queue", "backlog_ms", "score"}, {Format::INT, Format::INT, Format::MILLI}, "peer"},
+    {"ELECTION", {"changed", nullptr, "score"}, {Format::INT, Format::NONE, Format::MILLI}, "leader"},
+    {"STEAL", {"tasks", nullptr, nullptr}, {Format::INT, Format::NONE, Format::NONE}, "from"},
+    {"STOLEN", {"tasks", nullptr, nullptr}, {Format::INT, Format::NONE, Format::NONE}, "by"},
+};
+
+// Pairs a tick reading with wall clock time, to place events in real time
+uint64_t g_base_ticks = flight_internal::ticks();
+int64_t g_base_wall_ns = 0;
+
+char g_path[512];
+std::atomic<bool> g_dumping{false};
+
+int64_t wall_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+// Output for the dump: fixed buffer, flushed with write(2). No malloc, no stdio.
+class Writer {
+public:
+    explicit Writer(int fd) : fd_(fd) {}
+    ~Writer() { Flush(); }
+
+    void Str(const char* s, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            if (used_ == sizeof(buf_)) {
+                Flush();
+            }
+            buf_[used_++] = s[i];
+        }
+    }
+    void Str(const char* s) { Str(s, std::strlen(s)); }
+    void Uint(uint64_t v, int min_digits = 1) {
+        char digits[24];
+        int n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        } while (v != 0 || n < min_digits);
+        while (n > 0) {
+            Str(&digits[--n], 1);
+        }
+    }
+    void Int(int64_t v) {
+        if (v < 0) {
+            Str("-", 1);
+            Uint(0 - static_cast<uint64_t>(v));
+        } else {
+            Uint(static_cast<uint64_t>(v));
+        }
+    }
+    void Hex(uint64_t v) {
+        static const char kDigits[] = "0123456789abcdef";
+        char digits[16];
+        int n = 0;
+        do {
+            digits[n++] = kDigits[v & 0xf];
+            v >>= 4;
+        } while (v != 0);
+        Str("0x", 2);
+        while (n > 0) {
+            Str(&digits[--n], 1);
+        }
+    }
+    void Milli(int64_t v) {
+        if (v < 0) {
+            Str("-", 1);
+            v = -v;
+        }
+        Uint(static_cast<uint64_t>(v) / 1000);
+        Str(".", 1);
+        Uint(static_cast<uint64_t>(v) % 1000, 3);
+    }
+    void Flush() {
+        size_t done = 0;
+        while (done < used_) {
+            ssize_t n = ::write(fd_, buf_ + done, used_ - done);
+            if (n <= 0) {
+                break;
+            }
+            done += static_cast<size_t>(n);
+        }
+        used_ = 0;
+    }
+
+private:
+    int fd_;
+    char buf_[4096];
+    size_t used_ = 0;
+};
+
+void write_event(Writer& w, const Event& e, int ring, int64_t wall_ns) {
+    w.Uint(static_cast<uint64_t>(wall_ns / 1000000000));
+    w.Str(".", 1);
+    w.Uint(static_cast<uint64_t>(wall_ns % 1000000000 / 1000), 6);
+    w.Str(" t");
+    w.Uint(static_cast<uint64_t>(ring));
+    w.Str(" ");
+    size_t type = static_cast<size_t>(e.type);
+    if (type >= sizeof(kFormats) / sizeof(kFormats[0])) {
+        w.Str("UNKNOWN\n");
+        return;
+    }
+    const EventFormat& f = kFormats[type];
+    w.Str(f.name);
+    const int64_t args[3] = {e.a, e.b, e.c};
+    for (int i = 0; i < 3; ++i) {
+        if (f.formats[i] == Format::NONE) {
+            continue;
+        }
+        w.Str(" ");
+        w.Str(f.keys[i]);
+        w.Str("=");
+        switch (f.formats[i]) {
+            case Format::INT:   w.Int(args[i]); break;
+            case Format::HEX:   w.Hex(static_cast<uint64_t>(args[i])); break;
+            case Format::MILLI: w.Milli(args[i]); break;
+            case Format::NONE:  break;
+        }
+    }
+    if (f.text_key) {
+        w.Str(" ");
+        w.Str(f.text_key);
+        w.Str("=");
+        w.Str(e.text, e.text_len);
+    }
+    w.Str("\n");
+}
+
+void on_signal(int sig) {
+    bool fatal = sig != SIGUSR1;
+    if (!g_dumping.exchange(true)) {
+        int fd = ::open(g_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd >= 0) {
+            flight_dump(fd, fatal ? "fatal signal" : "SIGUSR1");
+            ::close(fd);
+        }
+        g_dumping.store(false);
+    }
+    if (fatal) {
+        // The handler was reset on entry, so this ends the process as the signal would have
+        ::raise(sig);
+    }
+}
+
+}  // namespace
+
+void flight_dump(int fd, const char* reason) {
+    // Scale ticks to wall time over the whole span since install
+    uint64_t now_ticks = flight_internal::ticks();
+    int64_t now_wall = wall_ns();
+    double ns_per_tick = now_ticks > g_base_ticks
+        ? static_cast<double>(now_wall - g_base_wall_ns) / static_cast<double>(now_ticks - g_base_ticks)
+        : 1.0;
+
+    uint64_t next[kFlightRings];
+    uint64_t end[kFlightRings];
+    uint64_t total = 0;
+    for (int r = 0; r < kFlightRings; ++r) {
+        end[r] = g_rings[r].head.load(std::memory_order_acquire);
+        next[r] = end[r] > kFlightRingEvents ? end[r] - kFlightRingEvents : 0;
+        total += end[r] - next[r];
+    }
+
+    Writer w(fd);
+    w.Str("# flight recorder, pid ");
+    w.Uint(static_cast<uint64_t>(::getpid()));
+    w.Str(", ");
+    w.Uint(total);
+    w.Str(" events, ");
+    w.Str(reason);
+    w.Str("\n");
+
+    // Each ring is in time order; merge them oldest first
+    while (true) {
+        int best = -1;
+        for (int r = 0; r < kFlightRings; ++r) {
+            if (next[r] < end[r] &&
+                (best < 0 || g_rings[r].events[next[r] & (kFlightRingEvents - 1)].ticks <
+                             g_rings[best].events[next[best] & (kFlightRingEvents - 1)].ticks)) {
+                best = r;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        // The ring's thread may still be recording: copy the event, then
+        // drop it if the thread has since come round to its slot again
+        uint64_t index = next[best]++;
+        Event e = g_rings[best].events[index & (kFlightRingEvents - 1)];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t head = g_rings[best].head.load(std::memory_order_relaxed);
+        if (head >= index + kFlightRingEvents) {
+            next[best] = std::max(next[best], head - kFlightRingEvents + 1);
+            continue;
+        }
+        int64_t wall = g_base_wall_ns + static_cast<int64_t>(
+            static_cast<double>(static_cast<int64_t>(e.ticks - g_base_ticks)) * ns_per_tick);
+        write_event(w, e, best, wall);
+    }
+}
+
+bool flight_recorder_install(const std::string& path) {
+    if (path.size() >= sizeof(g_path)) {
+        return false;
+    }
+    std::memcpy(g_path, path.c_str(), path.size() + 1);
+    g_base_ticks = flight_internal::ticks();
+    g_base_wall_ns = wall_ns();
+
+    struct sigaction dump = {};
+    dump.sa_handler = on_signal;
+    sigemptyset(&dump.sa_mask);
+    dump.sa_flags = SA_RESTART;
+    if (sigaction(SIGUSR1, &dump, nullptr) != 0) {
+        return false;
+    }
+    dump.sa_flags = SA_RESETHAND;
+    for (int sig : {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT}) {
+        if (sigaction(sig, &dump, nullptr) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
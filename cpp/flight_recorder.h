@@ -0,0 +1,116 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Always-on record of the node's recent history, for post-mortems. Each
+// thread writes fixed-size events into its own ring in static storage, so
+// recording never allocates, never locks and costs a cycle counter read and
+// a cache line store. The rings keep the newest events; they are written out,
+// merged by time, on SIGUSR1 or when the process dies of a fatal signal.
+// A ring is handed back when its thread exits and keeps its events until
+// another thread claims it. While every ring is held, other threads record
+// nothing, since two writers on one ring would corrupt each other's events.
+//
+//     flight_record(FlightEvent::ENQUEUE, task.task_id(), queue_length, task.trace_id());
+
+enum class FlightEvent : uint16_t {
+    ENQUEUE,         // task_id, queue length after, trace_id
+    DEQUEUE,         // task_id, queued us, queue length after
+    DONE,            // task_id, run us
+    FORWARD,         // task_id, -, trace_id; text: target
+    HEARTBEAT_SEND,  // ok, rtt us, score x1000; text: peer
+    HEARTBEAT_RECV,  // queue length, backlog ms, score x1000; text: peer
+    ELECTION,        // leader changed, -, own score x1000; text: leader
+    STEAL,           // tasks taken; text: victim
+    STOLEN,          // tasks given; text: thief
+};
+
+constexpr int kFlightRings = 64;              // threads recording at once; more record nothing
+constexpr uint64_t kFlightRingEvents = 2048;  // per ring, a power of two
+
+// Installs the dump handlers; dumps go to path, which is truncated each time
+bool flight_recorder_install(const std::string& path);
+
+// Writes every ring to fd now. Async-signal-safe.
+void flight_dump(int fd, const char* reason);
+
+namespace flight_internal {
+
+constexpr size_t kTextBytes = 29;
+
+struct alignas(64) Event {
+    uint64_t ticks;
+    int64_t a;
+    int64_t b;
+    int64_t c;
+    FlightEvent type;
+    uint8_t text_len;
+    char text[kTextBytes];
+};
+
+struct Ring {
+    alignas(64) std::atomic<uint64_t> head{0};
+    std::atomic<bool> owned{false};  // by a live thread, the only one to write here
+    Event events[kFlightRingEvents];
+};
+
+extern Ring g_rings[kFlightRings];
+inline thread_local Ring* t_ring = nullptr;
+
+Ring* claim_ring();  // nullptr while every ring is owned
+
+inline Ring* thread_ring() {
+    Ring* ring = t_ring;
+    return ring ? ring : claim_ring();
+}
+
+inline uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t v;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+}  // namespace flight_internal
+
+inline void flight_record(FlightEvent type, int64_t a, int64_t b = 0, int64_t c = 0,
+                          const char* text = nullptr, size_t text_len = 0) {
+    flight_internal::Ring* ring = flight_internal::thread_ring();
+    if (!ring) {
+        return;
+    }
+    // Only the owning thread writes head, so no read-modify-write is needed
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    flight_internal::Event& e = ring->events[head & (kFlightRingEvents - 1)];
+    e.ticks = flight_internal::ticks();
+    e.a = a;
+    e.b = b;
+    e.c = c;
+    e.type = type;
+    e.text_len = static_cast<uint8_t>(text_len < flight_internal::kTextBytes ? text_len
+                                                                             : flight_internal::kTextBytes);
+    if (text) {
+        std::memcpy(e.text, text, e.text_len);
+    }
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+inline void flight_record(FlightEvent type, int64_t a, int64_t b, int64_t c, const std::string& text) {
+    flight_record(type, a, b, c, text.data(), text.size());
+}
+
+#endif // FLIGHT_RECORDER_H
@@ -0,0 +1,126 @@
+#include "forwarder.h"
+#include "trace.h"
+#include <algorithm>
+#include <iterator>
+
+Forwarder::Forwarder(const ForwarderOptions& options, StubFn get_stub, FailureFn on_failure)
+    : options_(options), get_stub_(std::move(get_stub)), on_failure_(std::move(on_failure)) {
+    options_.max_batch = std::max(1, options_.max_batch);
+    options_.max_in_flight = std::max(1, options_.max_in_flight);
+    flusher_ = std::thread(&Forwarder::FlushLoop, this);
+}
+
+Forwarder::~Forwarder() {
+    Stop();
+}
+
+void Forwarder::Enqueue(const std::string& peer_address, leader::Task task) {
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Destination& dest = destinations_[peer_address];
+        if (dest.pending.empty()) {
+            dest.oldest = Clock::now();
+            wake = true;  // new flush deadline
+        }
+        dest.pending.push_back(std::move(task));
+        wake = wake || dest.pending.size() == static_cast<size_t>(options_.max_batch);
+    }
+    if (wake) {
+        cv_.notify_one();
+    }
+}
+
+void Forwarder::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+}
+
+void Forwarder::FlushLoop() {
+    trace_set_thread_name("forwarder");
+    const auto interval = std::chrono::microseconds(options_.flush_interval_us);
+    const size_t max_batch = static_cast<size_t>(options_.max_batch);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        auto now = Clock::now();
+        auto wake = now + std::chrono::milliseconds(100);
+        bool pending = false;
+        std::vector<std::pair<std::string, std::vector<leader::Task>>> ready;
+
+        for (auto& [peer, dest] : destinations_) {
+            while (!dest.pending.empty() && dest.in_flight < options_.max_in_flight) {
+                bool full = dest.pending.size() >= max_batch;
+                if (!full && !stopping_ && now - dest.oldest < interval) {
+                    wake = std::min(wake, dest.oldest + interval);
+                    break;
+                }
+                size_t n = std::min(dest.pending.size(), max_batch);
+                auto first = dest.pending.begin();
+                auto last = first + static_cast<std::ptrdiff_t>(n);
+                ready.emplace_back(peer, std::vector<leader::Task>(std::make_move_iterator(first),
+                                                                   std::make_move_iterator(last)));
+                dest.pending.erase(first, last);
+                ++dest.in_flight;
+                ++total_in_flight_;
+            }
+            pending = pending || !dest.pending.empty();
+        }
+
+        if (!ready.empty()) {
+            lock.unlock();
+            for (auto& [peer, batch] : ready) {
+                Send(peer, std::move(batch));
+            }
+            lock.lock();
+            continue;
+        }
+        if (stopping_ && !pending && total_in_flight_ == 0) {
+            return;
+        }
+        cv_.wait_until(lock, wake);
+    }
+}
+
+void Forwarder::Send(const std::string& peer_address, std::vector<leader::Task> tasks) {
+    struct Call {
+        grpc::ClientContext context;
+        leader::TaskBatch batch;
+        leader::Ack ack;
+    };
+
+    TraceSpan span("task", "forward_batch");
+    span.Arg("peer", peer_address);
+    span.Arg("tasks", static_cast<int64_t>(tasks.size()));
+
+    auto* call = new Call;
+    call->context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(5));
+    for (auto& task : tasks) {
+        *call->batch.add_tasks() = std::move(task);
+    }
+
+    get_stub_(peer_address)->async()->AssignTasks(
+        &call->context, &call->batch, &call->ack,
+        [this, call, peer_address](grpc::Status s) {
+            if (!s.ok()) {
+                std::vector<leader::Task> failed(
+                    std::make_move_iterator(call->batch.mutable_tasks()->begin()),
+                    std::make_move_iterator(call->batch.mutable_tasks()->end()));
+                on_failure_(peer_address, failed);
+            }
+            delete call;
+
+            // Notify under the lock: once total_in_flight_ reaches 0, Stop() may
+            // return and destroy this Forwarder as soon as the lock is released
+            std::lock_guard<std::mutex> lock(mutex_);
+            --destinations_[peer_address].in_flight;
+            --total_in_flight_;
+            cv_.notify_all();
+        });
+}
@@ -0,0 +1,62 @@
+#ifndef FORWARDER_H
+#define FORWARDER_H
+
+#include "leader.grpc.pb.h"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct ForwarderOptions {
+    int max_batch = 64;           // flush a destination once this many tasks wait
+    int flush_interval_us = 500;  // ...or once its oldest task has waited this long
+    int max_in_flight = 4;        // AssignTasks calls outstanding per destination
+};
+
+// Per-destination outbound queues drained by one flusher thread. Tasks headed
+// to the same peer are coalesced into AssignTasks batches, and up to
+// max_in_flight batches per peer are pipelined with the async stub, so the
+// dispatcher never waits on a round trip.
+class Forwarder {
+public:
+    using StubFn = std::function<leader::NodeService::Stub*(const std::string&)>;
+    // Gets the tasks of a batch that could not be delivered
+    using FailureFn = std::function<void(const std::string&, std::vector<leader::Task>&)>;
+
+    Forwarder(const ForwarderOptions& options, StubFn get_stub, FailureFn on_failure);
+    ~Forwarder();
+
+    void Enqueue(const std::string& peer_address, leader::Task task);
+
+    // Sends whatever is still queued and waits for every batch to finish
+    void Stop();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Destination {
+        std::vector<leader::Task> pending;
+        Clock::time_point oldest;
+        int in_flight = 0;
+    };
+
+    void FlushLoop();
+    void Send(const std::string& peer_address, std::vector<leader::Task> tasks);
+
+    ForwarderOptions options_;
+    StubFn get_stub_;
+    FailureFn on_failure_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<std::string, Destination> destinations_;
+    int total_in_flight_ = 0;
+    bool stopping_ = false;
+    std::thread flusher_;
+};
+
+#endif // FORWARDER_H
@@ -0,0 +1,51 @@
+#include "hash_ring.h"
+#include <algorithm>
+
+const std::string HashRing::kNone;
+
+uint64_t hash_key(const std::string& key) {
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : key) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+HashRing::HashRing(int virtual_nodes) : virtual_nodes_(std::max(1, virtual_nodes)) {}
+
+void HashRing::AddNode(const std::string& node) {
+    if (std::find(nodes_.begin(), nodes_.end(), node) != nodes_.end()) {
+        return;
+    }
+    nodes_.push_back(node);
+    for (int i = 0; i < virtual_nodes_; ++i) {
+        ring_.emplace_back(hash_key(node + "#" + std::to_string(i)), node);
+    }
+    std::sort(ring_.begin(), ring_.end());
+}
+
+void HashRing::RemoveNode(const std::string& node) {
+    nodes_.erase(std::remove(nodes_.begin(), nodes_.end(), node), nodes_.end());
+    ring_.erase(std::remove_if(ring_.begin(), ring_.end(),
+                               [&](const auto& entry) { return entry.second == node; }),
+                ring_.end());
+}
+
+const std::string& HashRing::Owner(const std::string& key) const {
+    if (ring_.empty()) {
+        return kNone;
+    }
+    return ring_[FirstAtOrAfter(hash_key(key))].second;
+}
+
+size_t HashRing::FirstAtOrAfter(uint64_t h) const {
+    auto it = std::lower_bound(ring_.begin(), ring_.end(), h,
+                               [](const auto& entry, uint64_t value) { return entry.first < value; });
+    return it == ring_.end() ? 0 : static_cast<size_t>(it - ring_.begin());
+}
@@ -0,0 +1,69 @@
+#ifndef HASH_RING_H
+#define HASH_RING_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Stable 64-bit hash (FNV-1a plus a splitmix64 finalizer). Unlike std::hash it
+// gives the same answer on every node and build.
+uint64_t hash_key(const std::string& key);
+
+// Consistent-hash ring with virtual nodes. Adding or removing a node only
+// moves the keys that land on that node's arcs, about 1/n of them.
+class HashRing {
+public:
+    explicit HashRing(int virtual_nodes = 128);
+
+    void AddNode(const std::string& node);
+    void RemoveNode(const std::string& node);
+    bool empty() const { return ring_.empty(); }
+    size_t node_count() const { return nodes_.size(); }
+
+    // Node that owns key, or "" if the ring is empty
+    const std::string& Owner(const std::string& key) const;
+
+    // Walks clockwise from key's position and returns the first node whose
+    // load(node) is below max_load (bounded-load consistent hashing). Falls
+    // back to Owner(key) when every node is at or above the bound.
+    template <typename LoadFn>
+    const std::string& BoundedOwner(const std::string& key, double max_load, LoadFn load) const;
+
+private:
+    size_t FirstAtOrAfter(uint64_t h) const;
+
+    int virtual_nodes_;
+    std::vector<std::string> nodes_;
+    std::vector<std::pair<uint64_t, std::string>> ring_;  // sorted by hash
+    static const std::string kNone;
+};
+
+template <typename LoadFn>
+const std::string& HashRing::BoundedOwner(const std::string& key, double max_load, LoadFn load) const {
+    if (ring_.empty()) {
+        return kNone;
+    }
+    size_t start = FirstAtOrAfter(hash_key(key));
+    std::vector<const std::string*> checked;
+    for (size_t step = 0; step < ring_.size() && checked.size() < nodes_.size(); ++step) {
+        const std::string& node = ring_[(start + step) % ring_.size()].second;
+        bool seen = false;
+        for (const std::string* c : checked) {
+            if (*c == node) {
+                seen = true;
+                break;
+            }
+        }
+        if (seen) {
+            continue;
+        }
+        if (load(node) < max_load) {
+            return node;
+        }
+        checked.push_back(&node);
+    }
+    return ring_[start].second;
+}
+
+#endif // HASH_RING_H
@@ -0,0 +1,155 @@
+#include "hdr_histogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+int floor_log2(uint64_t v) {
+    return 63 - __builtin_clzll(v);
+}
+
+}  // namespace
+
+HdrHistogram::HdrHistogram(int64_t highest, int significant_digits)
+    : highest_(std::max<int64_t>(2, highest)) {
+    significant_digits = std::min(5, std::max(1, significant_digits));
+    // Values up to this one land in a bucket of width 1
+    int64_t single_unit_resolution = 2 * static_cast<int64_t>(std::pow(10, significant_digits));
+    int sub_bucket_count_magnitude = static_cast<int>(std::ceil(std::log2(single_unit_resolution)));
+    sub_bucket_half_count_magnitude_ = sub_bucket_count_magnitude - 1;
+    sub_bucket_count_ = int64_t{1} << sub_bucket_count_magnitude;
+    sub_bucket_half_count_ = sub_bucket_count_ / 2;
+    sub_bucket_mask_ = sub_bucket_count_ - 1;
+
+    // Each bucket doubles the range of the one before
+    int64_t smallest_untrackable = sub_bucket_count_;
+    bucket_count_ = 1;
+    while (smallest_untrackable <= highest_) {
+        if (smallest_untrackable > INT64_MAX / 2) {
+            ++bucket_count_;
+            break;
+        }
+        smallest_untrackable <<= 1;
+        ++bucket_count_;
+    }
+    counts_len_ = static_cast<int>((bucket_count_ + 1) * sub_bucket_half_count_);
+    counts_.reset(new std::atomic<int64_t>[counts_len_]);
+    Reset();
+}
+
+int HdrHistogram::CountsIndex(int64_t value) const {
+    int bucket = floor_log2(static_cast<uint64_t>(value | sub_bucket_mask_)) -
+                 sub_bucket_half_count_magnitude_;
+    int64_t sub_bucket = value >> bucket;
+    return static_cast<int>(((bucket + 1) << sub_bucket_half_count_magnitude_) +
+                            (sub_bucket - sub_bucket_half_count_));
+}
+
+int64_t HdrHistogram::ValueAtIndex(int index) const {
+    int bucket = (index >> sub_bucket_half_count_magnitude_) - 1;
+    int64_t sub_bucket = (index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+    if (bucket < 0) {
+        sub_bucket -= sub_bucket_half_count_;
+        bucket = 0;
+    }
+    return sub_bucket << bucket;
+}
+
+// Largest value that shares value's bucket
+int64_t HdrHistogram::HighestEquivalent(int64_t value) const {
+    int bucket = floor_log2(static_cast<uint64_t>(value | sub_bucket_mask_)) -
+                 sub_bucket_half_count_magnitude_;
+    int64_t sub_bucket = value >> bucket;
+    int width_magnitude = bucket + (sub_bucket >= sub_bucket_count_ ? 1 : 0);
+    int64_t lowest = (sub_bucket << bucket);
+    return lowest + (int64_t{1} << width_magnitude) - 1;
+}
+
+void HdrHistogram::Record(int64_t value, int64_t count) {
+    value = std::min(highest_, std::max<int64_t>(1, value));
+    counts_[CountsIndex(value)].fetch_add(count, std::memory_order_relaxed);
+    total_.fetch_add(count, std::memory_order_relaxed);
+}
+
+void HdrHistogram::RecordCorrected(int64_t value, int64_t expected_interval) {
+    Record(value);
+    if (expected_interval <= 0) {
+        return;
+    }
+    for (int64_t missing = value - expected_interval; missing >= expected_interval;
+         missing -= expected_interval) {
+        Record(missing);
+    }
+}
+
+void HdrHistogram::Add(const HdrHistogram& other) {
+    int n = std::min(counts_len_, other.counts_len_);
+    for (int i = 0; i < n; ++i) {
+        int64_t c = other.counts_[i].load(std::memory_order_relaxed);
+        if (c != 0) {
+            counts_[i].fetch_add(c, std::memory_order_relaxed);
+            total_.fetch_add(c, std::memory_order_relaxed);
+        }
+    }
+}
+
+void HdrHistogram::Reset() {
+    for (int i = 0; i < counts_len_; ++i) {
+        counts_[i].store(0, std::memory_order_relaxed);
+    }
+    total_.store(0, std::memory_order_relaxed);
+}
+
+int64_t HdrHistogram::TotalCount() const {
+    return total_.load(std::memory_order_relaxed);
+}
+
+int64_t HdrHistogram::ValueAtPercentile(double percentile) const {
+    int64_t total = TotalCount();
+    if (total == 0) {
+        return 0;
+    }
+    percentile = std::min(100.0, std::max(0.0, percentile));
+    int64_t target = std::max<int64_t>(1, static_cast<int64_t>(std::ceil(percentile / 100.0 * total)));
+    int64_t seen = 0;
+    for (int i = 0; i < counts_len_; ++i) {
+        seen += counts_[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            return HighestEquivalent(ValueAtIndex(i));
+        }
+    }
+    return Max();
+}
+
+int64_t HdrHistogram::Max() const {
+    for (int i = counts_len_ - 1; i >= 0; --i) {
+        if (counts_[i].load(std::memory_order_relaxed) != 0) {
+            return HighestEquivalent(ValueAtIndex(i));
+        }
+    }
+    return 0;
+}
+
+int64_t HdrHistogram::Min() const {
+    for (int i = 0; i < counts_len_; ++i) {
+        if (counts_[i].load(std::memory_order_relaxed) != 0) {
+            return ValueAtIndex(i);
+        }
+    }
+    return 0;
+}
+
+double HdrHistogram::Mean() const {
+    double sum = 0.0;
+    int64_t total = 0;
+    for (int i = 0; i < counts_len_; ++i) {
+        int64_t c = counts_[i].load(std::memory_order_relaxed);
+        if (c != 0) {
+            // Middle of the bucket, as HdrHistogram does
+            int64_t low = ValueAtIndex(i);
+            sum += c * (low + HighestEquivalent(low)) / 2.0;
+            total += c;
+        }
+    }
+    return total > 0 ? sum / total : 0.0;
+}
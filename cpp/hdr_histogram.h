@@ -0,0 +1,52 @@
+#ifndef HDR_HISTOGRAM_H
+#define HDR_HISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// High dynamic range histogram (after Gil Tene's HdrHistogram): values from
+// 1 to highest are kept with a fixed number of significant decimal digits,
+// in log-linear buckets, so p99.9 of microsecond latencies is as exact as
+// p50 while memory stays a few tens of KB. Record() is a relaxed atomic
+// add and can be called from any thread; reads are approximate while
+// writers are active.
+class HdrHistogram {
+public:
+    // significant_digits in [1, 5]
+    HdrHistogram(int64_t highest, int significant_digits);
+
+    // Values below 1 count as 1 and above highest as highest
+    void Record(int64_t value, int64_t count = 1);
+
+    // For a recorder that measures one request per expected_interval and
+    // stalls while a response is late: also records the requests that would
+    // have been sent during the stall (coordinated omission correction)
+    void RecordCorrected(int64_t value, int64_t expected_interval);
+
+    void Add(const HdrHistogram& other);  // same layout only
+    void Reset();
+
+    int64_t TotalCount() const;
+    int64_t ValueAtPercentile(double percentile) const;  // 0 when empty
+    int64_t Max() const;
+    int64_t Min() const;
+    double Mean() const;
+
+private:
+    int64_t highest_;
+    int sub_bucket_half_count_magnitude_;
+    int64_t sub_bucket_count_;
+    int64_t sub_bucket_half_count_;
+    int64_t sub_bucket_mask_;
+    int bucket_count_;
+    int counts_len_;
+    std::unique_ptr<std::atomic<int64_t>[]> counts_;
+    std::atomic<int64_t> total_{0};
+
+    int CountsIndex(int64_t value) const;
+    int64_t ValueAtIndex(int index) const;
+    int64_t HighestEquivalent(int64_t value) const;
+};
+
+#endif // HDR_HISTOGRAM_H
@@ -0,0 +1,231 @@
+#include "host_stats.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+
+namespace {
+
+std::atomic<float> g_cpu_free{100.0f};
+std::atomic<float> g_mem_free{100.0f};
+std::atomic<float> g_load_avg{0.0f};
+std::atomic<bool> g_started{false};
+
+const std::string kCgroupMount = "/sys/fs/cgroup";
+
+struct CpuTimes {
+    unsigned long long idle = 0;
+    unsigned long long total = 0;
+    bool ok = false;
+};
+
+// Aggregate "cpu" line: user nice system idle iowait irq softirq steal ...
+// (guest time is already counted in user and nice, so stop after steal)
+CpuTimes read_proc_stat() {
+    CpuTimes t;
+    std::ifstream f("/proc/stat");
+    std::string label;
+    if (!(f >> label) || label != "cpu") {
+        return t;
+    }
+    unsigned long long v;
+    int i = 0;
+    for (; i < 8 && (f >> v); ++i) {
+        t.total += v;
+        if (i == 3 || i == 4) {
+            t.idle += v;
+        }
+    }
+    t.ok = i >= 4;
+    return t;
+}
+
+// The whole of text as a finite number; false for "max", "" or anything malformed
+bool parse_number(const std::string& text, double* value) {
+    if (text.empty()) {
+        return false;
+    }
+    char* end = nullptr;
+    double v = std::strtod(text.c_str(), &end);
+    if (end != text.c_str() + text.size() || !std::isfinite(v)) {
+        return false;
+    }
+    *value = v;
+    return true;
+}
+
+bool is_dir(const std::string& path) {
+    struct stat st;
+    return ::stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+// This process's cgroup v2 directory and its ancestors up to the mount,
+// innermost first, each ending in '/'. From the "0::" line of
+// /proc/self/cgroup; just the mount if that path is not visible here, as in
+// a container with its own cgroup namespace mounted at its root.
+const std::vector<std::string>& cgroup_dirs() {
+    static const std::vector<std::string> dirs = [] {
+        std::string path;
+        std::ifstream f("/proc/self/cgroup");
+        std::string line;
+        while (std::getline(f, line)) {
+            if (line.rfind("0::", 0) == 0) {
+                path = line.substr(3);
+                break;
+            }
+        }
+        if (path.empty() || path.find("..") != std::string::npos || !is_dir(kCgroupMount + path)) {
+            path = "/";
+        }
+        std::vector<std::string> out;
+        while (true) {
+            out.push_back(kCgroupMount + path + (path.back() == '/' ? "" : "/"));
+            if (path == "/") {
+                break;
+            }
+            size_t slash = path.find_last_of('/');
+            path = slash == 0 ? "/" : path.substr(0, slash);
+        }
+        return out;
+    }();
+    return dirs;
+}
+
+// The tightest cpu.max over this cgroup and its ancestors, in CPUs, and the
+// directory that sets it; 0 CPUs when none limits
+double read_cgroup_cpu_limit(std::string* dir) {
+    double tightest = 0.0;
+    for (const std::string& d : cgroup_dirs()) {
+        std::ifstream f(d + "cpu.max");
+        std::string quota_text, period_text;
+        double quota, period;
+        if ((f >> quota_text >> period_text) && parse_number(quota_text, &quota) &&
+            parse_number(period_text, &period) && quota > 0.0 && period > 0.0 &&
+            (tightest == 0.0 || quota / period < tightest)) {
+            tightest = quota / period;
+            *dir = d;
+        }
+    }
+    return tightest;
+}
+
+// CPU time used by the cgroup at dir so far, in microseconds, or -1, as
+// when no cgroup limits and dir is empty
+long long read_cgroup_cpu_usage(const std::string& dir) {
+    if (dir.empty()) {
+        return -1;
+    }
+    std::ifstream f(dir + "cpu.stat");
+    std::string key, value_text;
+    double value;
+    while (f >> key >> value_text) {
+        if (key == "usage_usec") {
+            return parse_number(value_text, &value) ? static_cast<long long>(value) : -1;
+        }
+    }
+    return -1;
+}
+
+float read_mem_free() {
+    std::ifstream f("/proc/meminfo");
+    std::string key, unit;
+    double value, total = 0.0, available = 0.0;
+    while (f >> key >> value >> unit) {
+        if (key == "MemTotal:") {
+            total = value * 1024.0;
+        } else if (key == "MemAvailable:") {
+            available = value * 1024.0;
+        }
+    }
+    float free = total > 0.0 ? static_cast<float>(100.0 * available / total) : 100.0f;
+
+    // Any level of the hierarchy may set the limit that binds first
+    for (const std::string& dir : cgroup_dirs()) {
+        std::ifstream max_file(dir + "memory.max");
+        std::ifstream current_file(dir + "memory.current");
+        std::string max_text, current_text;
+        double limit, current;
+        if ((max_file >> max_text) && (current_file >> current_text) && parse_number(max_text, &limit) &&
+            parse_number(current_text, &current) && limit > 0.0) {
+            free = std::min(free, static_cast<float>(100.0 * std::max(0.0, limit - current) / limit));
+        }
+    }
+    return free;
+}
+
+float read_load_avg() {
+    std::ifstream f("/proc/loadavg");
+    float load = 0.0f;
+    f >> load;
+    return load;
+}
+
+void sample_loop(int interval_ms) {
+    using Clock = std::chrono::steady_clock;
+    const float cpus = static_cast<float>(std::max(1u, std::thread::hardware_concurrency()));
+
+    // Until there are two /proc/stat samples, estimate CPU from the load average
+    float load = read_load_avg();
+    g_load_avg.store(load, std::memory_order_relaxed);
+    g_cpu_free.store(100.0f * (1.0f - std::min(1.0f, load / cpus)), std::memory_order_relaxed);
+    g_mem_free.store(read_mem_free(), std::memory_order_relaxed);
+
+    CpuTimes prev = read_proc_stat();
+    std::string prev_dir;
+    read_cgroup_cpu_limit(&prev_dir);
+    long long prev_usage = read_cgroup_cpu_usage(prev_dir);
+    auto prev_time = Clock::now();
+
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+
+        CpuTimes cur = read_proc_stat();
+        std::string dir;
+        double limit = read_cgroup_cpu_limit(&dir);
+        long long usage = read_cgroup_cpu_usage(dir);
+        auto now = Clock::now();
+
+        float cpu_free = 100.0f;
+        if (cur.ok && prev.ok && cur.total > prev.total) {
+            cpu_free = 100.0f * static_cast<float>(cur.idle - prev.idle) /
+                       static_cast<float>(cur.total - prev.total);
+        }
+        double wall_us = std::chrono::duration<double, std::micro>(now - prev_time).count();
+        if (limit > 0.0 && dir == prev_dir && usage >= prev_usage && prev_usage >= 0 && wall_us > 0.0) {
+            double used = static_cast<double>(usage - prev_usage) / (limit * wall_us);
+            cpu_free = std::min(cpu_free, static_cast<float>(100.0 * (1.0 - std::min(1.0, used))));
+        }
+
+        g_cpu_free.store(cpu_free, std::memory_order_relaxed);
+        g_mem_free.store(read_mem_free(), std::memory_order_relaxed);
+        g_load_avg.store(read_load_avg(), std::memory_order_relaxed);
+
+        prev = cur;
+        prev_dir = dir;
+        prev_usage = usage;
+        prev_time = now;
+    }
+}
+
+}  // namespace
+
+void start_host_sampler(int interval_ms) {
+    if (g_started.exchange(true)) {
+        return;
+    }
+    std::thread(sample_loop, std::max(10, interval_ms)).detach();
+}
+
+HostLoad current_host_load() {
+    HostLoad load;
+    load.cpu_free = g_cpu_free.load(std::memory_order_relaxed);
+    load.mem_free = g_mem_free.load(std::memory_order_relaxed);
+    load.load_avg = g_load_avg.load(std::memory_order_relaxed);
+    return load;
+}
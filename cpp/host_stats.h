@@ -0,0 +1,21 @@
+#ifndef HOST_STATS_H
+#define HOST_STATS_H
+
+// Latest sample of how much of this host (or of its cgroup, when that is
+// tighter) is still free.
+struct HostLoad {
+    float cpu_free = 100.0f;  // percent
+    float mem_free = 100.0f;  // percent
+    float load_avg = 0.0f;    // 1-minute load average from /proc/loadavg
+};
+
+// Starts the process-wide sampler thread, which rereads /proc/stat,
+// /proc/meminfo, /proc/loadavg and the cgroup v2 cpu.max, cpu.stat,
+// memory.max and memory.current files of this process's cgroup and its
+// ancestors every interval_ms. Later calls do nothing.
+void start_host_sampler(int interval_ms);
+
+// Latest sample. Reads a few relaxed atomics: no locks, no syscalls.
+HostLoad current_host_load();
+
+#endif // HOST_STATS_H
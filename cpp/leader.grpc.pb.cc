@@ -24,6 +24,10 @@ namespace leader {
 static const char* NodeService_method_names[] = {
   "/leader.NodeService/Heartbeat",
   "/leader.NodeService/AssignTask",
+  "/leader.NodeService/StealTasks",
+  "/leader.NodeService/AssignTasks",
+  "/leader.NodeService/GetStats",
+  "/leader.NodeService/Trace",
 };
 
 std::unique_ptr< NodeService::Stub> NodeService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -35,6 +39,10 @@ std::unique_ptr< NodeService::Stub> NodeService::NewStub(const std::shared_ptr<
 NodeService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_Heartbeat_(NodeService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_AssignTask_(NodeService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_StealTasks_(NodeService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_AssignTasks_(NodeService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetStats_(NodeService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Trace_(NodeService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status NodeService::Stub::Heartbeat(::grpc::ClientContext* context, const ::leader::NodeStatus& request, ::leader::Ack* response) {
@@ -83,6 +91,98 @@ void NodeService::Stub::async::AssignTask(::grpc::ClientContext* context, const
   return result;
 }
 
+::grpc::Status NodeService::Stub::StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::leader::StealReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::leader::StealRequest, ::leader::StealReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_StealTasks_, context, request, response);
+}
+
+void NodeService::Stub::async::StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::leader::StealRequest, ::leader::StealReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StealTasks_, context, request, response, std::move(f));
+}
+
+void NodeService::Stub::async::StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_StealTasks_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::leader::StealReply>* NodeService::Stub::PrepareAsyncStealTasksRaw(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::leader::StealReply, ::leader::StealRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_StealTasks_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::leader::StealReply>* NodeService::Stub::AsyncStealTasksRaw(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStealTasksRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status NodeService::Stub::AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::leader::Ack* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::leader::TaskBatch, ::leader::Ack, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_AssignTasks_, context, request, response);
+}
+
+void NodeService::Stub::async::AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::leader::TaskBatch, ::leader::Ack, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_AssignTasks_, context, request, response, std::move(f));
+}
+
+void NodeService::Stub::async::AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_AssignTasks_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::leader::Ack>* NodeService::Stub::PrepareAsyncAssignTasksRaw(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::leader::Ack, ::leader::TaskBatch, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_AssignTasks_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::leader::Ack>* NodeService::Stub::AsyncAssignTasksRaw(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncAssignTasksRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status NodeService::Stub::GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::leader::NodeStats* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::leader::StatsRequest, ::leader::NodeStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetStats_, context, request, response);
+}
+
+void NodeService::Stub::async::GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::leader::StatsRequest, ::leader::NodeStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, std::move(f));
+}
+
+void NodeService::Stub::async::GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetStats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::leader::NodeStats>* NodeService::Stub::PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::leader::NodeStats, ::leader::StatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetStats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::leader::NodeStats>* NodeService::Stub::AsyncGetStatsRaw(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status NodeService::Stub::Trace(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::leader::TraceReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::leader::TraceRequest, ::leader::TraceReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Trace_, context, request, response);
+}
+
+void NodeService::Stub::async::Trace(::grpc::ClientContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::leader::TraceRequest, ::leader::TraceReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Trace_, context, request, response, std::move(f));
+}
+
+void NodeService::Stub::async::Trace(::grpc::ClientContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Trace_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::leader::TraceReply>* NodeService::Stub::PrepareAsyncTraceRaw(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::leader::TraceReply, ::leader::TraceRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Trace_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::leader::TraceReply>* NodeService::Stub::AsyncTraceRaw(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncTraceRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 NodeService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       NodeService_method_names[0],
@@ -104,6 +204,46 @@ NodeService::Service::Service() {
              ::leader::Ack* resp) {
                return service->AssignTask(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      NodeService_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< NodeService::Service, ::leader::StealRequest, ::leader::StealReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](NodeService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::leader::StealRequest* req,
+             ::leader::StealReply* resp) {
+               return service->StealTasks(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      NodeService_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< NodeService::Service, ::leader::TaskBatch, ::leader::Ack, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](NodeService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::leader::TaskBatch* req,
+             ::leader::Ack* resp) {
+               return service->AssignTasks(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      NodeService_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< NodeService::Service, ::leader::StatsRequest, ::leader::NodeStats, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](NodeService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::leader::StatsRequest* req,
+             ::leader::NodeStats* resp) {
+               return service->GetStats(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      NodeService_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< NodeService::Service, ::leader::TraceRequest, ::leader::TraceReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](NodeService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::leader::TraceRequest* req,
+             ::leader::TraceReply* resp) {
+               return service->Trace(ctx, req, resp);
+             }, this)));
 }
 
 NodeService::Service::~Service() {
@@ -123,6 +263,34 @@ NodeService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status NodeService::Service::StealTasks(::grpc::ServerContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status NodeService::Service::AssignTasks(::grpc::ServerContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status NodeService::Service::GetStats(::grpc::ServerContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status NodeService::Service::Trace(::grpc::ServerContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace leader
 
@@ -50,6 +50,34 @@ class NodeService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>> PrepareAsyncAssignTask(::grpc::ClientContext* context, const ::leader::Task& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>>(PrepareAsyncAssignTaskRaw(context, request, cq));
     }
+    virtual ::grpc::Status StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::leader::StealReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::StealReply>> AsyncStealTasks(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::StealReply>>(AsyncStealTasksRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::StealReply>> PrepareAsyncStealTasks(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::StealReply>>(PrepareAsyncStealTasksRaw(context, request, cq));
+    }
+    virtual ::grpc::Status AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::leader::Ack* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>> AsyncAssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>>(AsyncAssignTasksRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>> PrepareAsyncAssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>>(PrepareAsyncAssignTasksRaw(context, request, cq));
+    }
+    virtual ::grpc::Status GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::leader::NodeStats* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::NodeStats>> AsyncGetStats(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::NodeStats>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::NodeStats>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::NodeStats>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status Trace(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::leader::TraceReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::TraceReply>> AsyncTrace(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::TraceReply>>(AsyncTraceRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::TraceReply>> PrepareAsyncTrace(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::leader::TraceReply>>(PrepareAsyncTraceRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -57,6 +85,14 @@ class NodeService final {
       virtual void Heartbeat(::grpc::ClientContext* context, const ::leader::NodeStatus* request, ::leader::Ack* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void AssignTask(::grpc::ClientContext* context, const ::leader::Task* request, ::leader::Ack* response, std::function<void(::grpc::Status)>) = 0;
       virtual void AssignTask(::grpc::ClientContext* context, const ::leader::Task* request, ::leader::Ack* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void Trace(::grpc::ClientContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Trace(::grpc::ClientContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -66,6 +102,14 @@ class NodeService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>* PrepareAsyncHeartbeatRaw(::grpc::ClientContext* context, const ::leader::NodeStatus& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>* AsyncAssignTaskRaw(::grpc::ClientContext* context, const ::leader::Task& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>* PrepareAsyncAssignTaskRaw(::grpc::ClientContext* context, const ::leader::Task& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::StealReply>* AsyncStealTasksRaw(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::StealReply>* PrepareAsyncStealTasksRaw(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>* AsyncAssignTasksRaw(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::Ack>* PrepareAsyncAssignTasksRaw(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::NodeStats>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::NodeStats>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::TraceReply>* AsyncTraceRaw(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::leader::TraceReply>* PrepareAsyncTraceRaw(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -84,6 +128,34 @@ class NodeService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::Ack>> PrepareAsyncAssignTask(::grpc::ClientContext* context, const ::leader::Task& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::Ack>>(PrepareAsyncAssignTaskRaw(context, request, cq));
     }
+    ::grpc::Status StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::leader::StealReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::StealReply>> AsyncStealTasks(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::StealReply>>(AsyncStealTasksRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::StealReply>> PrepareAsyncStealTasks(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::StealReply>>(PrepareAsyncStealTasksRaw(context, request, cq));
+    }
+    ::grpc::Status AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::leader::Ack* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::Ack>> AsyncAssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::Ack>>(AsyncAssignTasksRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::Ack>> PrepareAsyncAssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::Ack>>(PrepareAsyncAssignTasksRaw(context, request, cq));
+    }
+    ::grpc::Status GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::leader::NodeStats* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::NodeStats>> AsyncGetStats(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::NodeStats>>(AsyncGetStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::NodeStats>> PrepareAsyncGetStats(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::NodeStats>>(PrepareAsyncGetStatsRaw(context, request, cq));
+    }
+    ::grpc::Status Trace(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::leader::TraceReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::TraceReply>> AsyncTrace(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::TraceReply>>(AsyncTraceRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::TraceReply>> PrepareAsyncTrace(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::leader::TraceReply>>(PrepareAsyncTraceRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -91,6 +163,14 @@ class NodeService final {
       void Heartbeat(::grpc::ClientContext* context, const ::leader::NodeStatus* request, ::leader::Ack* response, ::grpc::ClientUnaryReactor* reactor) override;
       void AssignTask(::grpc::ClientContext* context, const ::leader::Task* request, ::leader::Ack* response, std::function<void(::grpc::Status)>) override;
       void AssignTask(::grpc::ClientContext* context, const ::leader::Task* request, ::leader::Ack* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response, std::function<void(::grpc::Status)>) override;
+      void StealTasks(::grpc::ClientContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response, std::function<void(::grpc::Status)>) override;
+      void AssignTasks(::grpc::ClientContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response, std::function<void(::grpc::Status)>) override;
+      void GetStats(::grpc::ClientContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Trace(::grpc::ClientContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response, std::function<void(::grpc::Status)>) override;
+      void Trace(::grpc::ClientContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -106,8 +186,20 @@ class NodeService final {
     ::grpc::ClientAsyncResponseReader< ::leader::Ack>* PrepareAsyncHeartbeatRaw(::grpc::ClientContext* context, const ::leader::NodeStatus& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::leader::Ack>* AsyncAssignTaskRaw(::grpc::ClientContext* context, const ::leader::Task& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::leader::Ack>* PrepareAsyncAssignTaskRaw(::grpc::ClientContext* context, const ::leader::Task& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::leader::StealReply>* AsyncStealTasksRaw(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::leader::StealReply>* PrepareAsyncStealTasksRaw(::grpc::ClientContext* context, const ::leader::StealRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::leader::Ack>* AsyncAssignTasksRaw(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::leader::Ack>* PrepareAsyncAssignTasksRaw(::grpc::ClientContext* context, const ::leader::TaskBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::leader::NodeStats>* AsyncGetStatsRaw(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::leader::NodeStats>* PrepareAsyncGetStatsRaw(::grpc::ClientContext* context, const ::leader::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::leader::TraceReply>* AsyncTraceRaw(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::leader::TraceReply>* PrepareAsyncTraceRaw(::grpc::ClientContext* context, const ::leader::TraceRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Heartbeat_;
     const ::grpc::internal::RpcMethod rpcmethod_AssignTask_;
+    const ::grpc::internal::RpcMethod rpcmethod_StealTasks_;
+    const ::grpc::internal::RpcMethod rpcmethod_AssignTasks_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetStats_;
+    const ::grpc::internal::RpcMethod rpcmethod_Trace_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -117,6 +209,10 @@ class NodeService final {
     virtual ~Service();
     virtual ::grpc::Status Heartbeat(::grpc::ServerContext* context, const ::leader::NodeStatus* request, ::leader::Ack* response);
     virtual ::grpc::Status AssignTask(::grpc::ServerContext* context, const ::leader::Task* request, ::leader::Ack* response);
+    virtual ::grpc::Status StealTasks(::grpc::ServerContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response);
+    virtual ::grpc::Status AssignTasks(::grpc::ServerContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response);
+    virtual ::grpc::Status GetStats(::grpc::ServerContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response);
+    virtual ::grpc::Status Trace(::grpc::ServerContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Heartbeat : public BaseClass {
@@ -158,7 +254,87 @@ class NodeService final {
       ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Heartbeat<WithAsyncMethod_AssignTask<Service > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_StealTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StealTasks() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_StealTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StealTasks(::grpc::ServerContext* /*context*/, const ::leader::StealRequest* /*request*/, ::leader::StealReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStealTasks(::grpc::ServerContext* context, ::leader::StealRequest* request, ::grpc::ServerAsyncResponseWriter< ::leader::StealReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_AssignTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_AssignTasks() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_AssignTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AssignTasks(::grpc::ServerContext* /*context*/, const ::leader::TaskBatch* /*request*/, ::leader::Ack* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestAssignTasks(::grpc::ServerContext* context, ::leader::TaskBatch* request, ::grpc::ServerAsyncResponseWriter< ::leader::Ack>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetStats() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::leader::StatsRequest* /*request*/, ::leader::NodeStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::leader::StatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::leader::NodeStats>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Trace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Trace() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_Trace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Trace(::grpc::ServerContext* /*context*/, const ::leader::TraceRequest* /*request*/, ::leader::TraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestTrace(::grpc::ServerContext* context, ::leader::TraceRequest* request, ::grpc::ServerAsyncResponseWriter< ::leader::TraceReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Heartbeat<WithAsyncMethod_AssignTask<WithAsyncMethod_StealTasks<WithAsyncMethod_AssignTasks<WithAsyncMethod_GetStats<WithAsyncMethod_Trace<Service > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Heartbeat : public BaseClass {
    private:
@@ -213,7 +389,115 @@ class NodeService final {
     virtual ::grpc::ServerUnaryReactor* AssignTask(
       ::grpc::CallbackServerContext* /*context*/, const ::leader::Task* /*request*/, ::leader::Ack* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_Heartbeat<WithCallbackMethod_AssignTask<Service > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_StealTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StealTasks() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::leader::StealRequest, ::leader::StealReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::leader::StealRequest* request, ::leader::StealReply* response) { return this->StealTasks(context, request, response); }));}
+    void SetMessageAllocatorFor_StealTasks(
+        ::grpc::MessageAllocator< ::leader::StealRequest, ::leader::StealReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::leader::StealRequest, ::leader::StealReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_StealTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StealTasks(::grpc::ServerContext* /*context*/, const ::leader::StealRequest* /*request*/, ::leader::StealReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* StealTasks(
+      ::grpc::CallbackServerContext* /*context*/, const ::leader::StealRequest* /*request*/, ::leader::StealReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_AssignTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_AssignTasks() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::leader::TaskBatch, ::leader::Ack>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::leader::TaskBatch* request, ::leader::Ack* response) { return this->AssignTasks(context, request, response); }));}
+    void SetMessageAllocatorFor_AssignTasks(
+        ::grpc::MessageAllocator< ::leader::TaskBatch, ::leader::Ack>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::leader::TaskBatch, ::leader::Ack>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_AssignTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AssignTasks(::grpc::ServerContext* /*context*/, const ::leader::TaskBatch* /*request*/, ::leader::Ack* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* AssignTasks(
+      ::grpc::CallbackServerContext* /*context*/, const ::leader::TaskBatch* /*request*/, ::leader::Ack* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetStats() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::leader::StatsRequest, ::leader::NodeStats>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::leader::StatsRequest* request, ::leader::NodeStats* response) { return this->GetStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetStats(
+        ::grpc::MessageAllocator< ::leader::StatsRequest, ::leader::NodeStats>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::leader::StatsRequest, ::leader::NodeStats>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::leader::StatsRequest* /*request*/, ::leader::NodeStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::leader::StatsRequest* /*request*/, ::leader::NodeStats* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Trace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Trace() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::leader::TraceRequest, ::leader::TraceReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::leader::TraceRequest* request, ::leader::TraceReply* response) { return this->Trace(context, request, response); }));}
+    void SetMessageAllocatorFor_Trace(
+        ::grpc::MessageAllocator< ::leader::TraceRequest, ::leader::TraceReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::leader::TraceRequest, ::leader::TraceReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Trace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Trace(::grpc::ServerContext* /*context*/, const ::leader::TraceRequest* /*request*/, ::leader::TraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Trace(
+      ::grpc::CallbackServerContext* /*context*/, const ::leader::TraceRequest* /*request*/, ::leader::TraceReply* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Heartbeat<WithCallbackMethod_AssignTask<WithCallbackMethod_StealTasks<WithCallbackMethod_AssignTasks<WithCallbackMethod_GetStats<WithCallbackMethod_Trace<Service > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Heartbeat : public BaseClass {
@@ -250,6 +534,74 @@ class NodeService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_StealTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StealTasks() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_StealTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StealTasks(::grpc::ServerContext* /*context*/, const ::leader::StealRequest* /*request*/, ::leader::StealReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_AssignTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_AssignTasks() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_AssignTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AssignTasks(::grpc::ServerContext* /*context*/, const ::leader::TaskBatch* /*request*/, ::leader::Ack* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetStats() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::leader::StatsRequest* /*request*/, ::leader::NodeStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Trace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Trace() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_Trace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Trace(::grpc::ServerContext* /*context*/, const ::leader::TraceRequest* /*request*/, ::leader::TraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Heartbeat : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -290,6 +642,86 @@ class NodeService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_StealTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StealTasks() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_StealTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StealTasks(::grpc::ServerContext* /*context*/, const ::leader::StealRequest* /*request*/, ::leader::StealReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStealTasks(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_AssignTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_AssignTasks() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_AssignTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AssignTasks(::grpc::ServerContext* /*context*/, const ::leader::TaskBatch* /*request*/, ::leader::Ack* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestAssignTasks(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetStats() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::leader::StatsRequest* /*request*/, ::leader::NodeStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Trace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Trace() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_Trace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Trace(::grpc::ServerContext* /*context*/, const ::leader::TraceRequest* /*request*/, ::leader::TraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestTrace(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Heartbeat : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -334,6 +766,94 @@ class NodeService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_StealTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StealTasks() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->StealTasks(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_StealTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StealTasks(::grpc::ServerContext* /*context*/, const ::leader::StealRequest* /*request*/, ::leader::StealReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* StealTasks(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_AssignTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_AssignTasks() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->AssignTasks(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_AssignTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status AssignTasks(::grpc::ServerContext* /*context*/, const ::leader::TaskBatch* /*request*/, ::leader::Ack* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* AssignTasks(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetStats() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetStats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::leader::StatsRequest* /*request*/, ::leader::NodeStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Trace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Trace() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Trace(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Trace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Trace(::grpc::ServerContext* /*context*/, const ::leader::TraceRequest* /*request*/, ::leader::TraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Trace(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Heartbeat : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -387,9 +907,117 @@ class NodeService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedAssignTask(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::leader::Task,::leader::Ack>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_AssignTask<Service > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_StealTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_StealTasks() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::leader::StealRequest, ::leader::StealReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::leader::StealRequest, ::leader::StealReply>* streamer) {
+                       return this->StreamedStealTasks(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_StealTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StealTasks(::grpc::ServerContext* /*context*/, const ::leader::StealRequest* /*request*/, ::leader::StealReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedStealTasks(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::leader::StealRequest,::leader::StealReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_AssignTasks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_AssignTasks() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::leader::TaskBatch, ::leader::Ack>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::leader::TaskBatch, ::leader::Ack>* streamer) {
+                       return this->StreamedAssignTasks(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_AssignTasks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status AssignTasks(::grpc::ServerContext* /*context*/, const ::leader::TaskBatch* /*request*/, ::leader::Ack* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedAssignTasks(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::leader::TaskBatch,::leader::Ack>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetStats() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::leader::StatsRequest, ::leader::NodeStats>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::leader::StatsRequest, ::leader::NodeStats>* streamer) {
+                       return this->StreamedGetStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetStats(::grpc::ServerContext* /*context*/, const ::leader::StatsRequest* /*request*/, ::leader::NodeStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::leader::StatsRequest,::leader::NodeStats>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Trace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Trace() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::leader::TraceRequest, ::leader::TraceReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::leader::TraceRequest, ::leader::TraceReply>* streamer) {
+                       return this->StreamedTrace(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Trace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Trace(::grpc::ServerContext* /*context*/, const ::leader::TraceRequest* /*request*/, ::leader::TraceReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedTrace(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::leader::TraceRequest,::leader::TraceReply>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_AssignTask<WithStreamedUnaryMethod_StealTasks<WithStreamedUnaryMethod_AssignTasks<WithStreamedUnaryMethod_GetStats<WithStreamedUnaryMethod_Trace<Service > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_AssignTask<Service > > StreamedService;
+  typedef WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_AssignTask<WithStreamedUnaryMethod_StealTasks<WithStreamedUnaryMethod_AssignTasks<WithStreamedUnaryMethod_GetStats<WithStreamedUnaryMethod_Trace<Service > > > > > > StreamedService;
 };
 
 }  // namespace leader
@@ -26,6 +26,12 @@ PROTOBUF_CONSTEXPR NodeStatus::NodeStatus(
     /*decltype(_impl_.node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.score_)*/0
   , /*decltype(_impl_.queue_length_)*/0
+  , /*decltype(_impl_.expected_wait_ms_)*/0
+  , /*decltype(_impl_.drain_ms_)*/0
+  , /*decltype(_impl_.backlog_ms_)*/int64_t{0}
+  , /*decltype(_impl_.capacity_)*/0
+  , /*decltype(_impl_.service_rate_)*/0
+  , /*decltype(_impl_.service_p99_ms_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct NodeStatusDefaultTypeInternal {
   PROTOBUF_CONSTEXPR NodeStatusDefaultTypeInternal()
@@ -38,8 +44,14 @@ struct NodeStatusDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeStatusDefaultTypeInternal _NodeStatus_default_instance_;
 PROTOBUF_CONSTEXPR Task::Task(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.task_id_)*/0
+    /*decltype(_impl_.routing_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tenant_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.task_id_)*/0
   , /*decltype(_impl_.duration_ms_)*/0
+  , /*decltype(_impl_.forwarded_)*/false
+  , /*decltype(_impl_.priority_)*/0
+  , /*decltype(_impl_.received_us_)*/int64_t{0}
+  , /*decltype(_impl_.trace_id_)*/uint64_t{0u}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TaskDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TaskDefaultTypeInternal()
@@ -50,6 +62,46 @@ struct TaskDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TaskDefaultTypeInternal _Task_default_instance_;
+PROTOBUF_CONSTEXPR StealRequest::StealRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.max_tasks_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StealRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StealRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StealRequestDefaultTypeInternal() {}
+  union {
+    StealRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StealRequestDefaultTypeInternal _StealRequest_default_instance_;
+PROTOBUF_CONSTEXPR StealReply::StealReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tasks_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StealReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StealReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StealReplyDefaultTypeInternal() {}
+  union {
+    StealReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StealReplyDefaultTypeInternal _StealReply_default_instance_;
+PROTOBUF_CONSTEXPR TaskBatch::TaskBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tasks_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TaskBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TaskBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TaskBatchDefaultTypeInternal() {}
+  union {
+    TaskBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TaskBatchDefaultTypeInternal _TaskBatch_default_instance_;
 PROTOBUF_CONSTEXPR Ack::Ack(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -63,8 +115,143 @@ struct AckDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AckDefaultTypeInternal _Ack_default_instance_;
+PROTOBUF_CONSTEXPR StatsRequest::StatsRequest(
+    ::_pbi::ConstantInitialized) {}
+struct StatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsRequestDefaultTypeInternal() {}
+  union {
+    StatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR NodeStats::NodeStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.metrics_)*/{}
+  , /*decltype(_impl_.latency_)*/{}
+  , /*decltype(_impl_.locks_)*/{}
+  , /*decltype(_impl_.node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leader_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.backlog_ms_)*/int64_t{0}
+  , /*decltype(_impl_.queue_length_)*/0
+  , /*decltype(_impl_.capacity_)*/0
+  , /*decltype(_impl_.tasks_completed_)*/int64_t{0}
+  , /*decltype(_impl_.arrival_rate_)*/0
+  , /*decltype(_impl_.service_rate_)*/0
+  , /*decltype(_impl_.service_mean_ms_)*/0
+  , /*decltype(_impl_.service_p50_ms_)*/0
+  , /*decltype(_impl_.service_p90_ms_)*/0
+  , /*decltype(_impl_.service_p99_ms_)*/0
+  , /*decltype(_impl_.expected_wait_ms_)*/0
+  , /*decltype(_impl_.drain_ms_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NodeStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeStatsDefaultTypeInternal() {}
+  union {
+    NodeStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeStatsDefaultTypeInternal _NodeStats_default_instance_;
+PROTOBUF_CONSTEXPR LockProfile::LockProfile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.lock_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.site_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.acquisitions_)*/int64_t{0}
+  , /*decltype(_impl_.contended_)*/int64_t{0}
+  , /*decltype(_impl_.wait_total_ms_)*/0
+  , /*decltype(_impl_.wait_p50_us_)*/0
+  , /*decltype(_impl_.wait_p99_us_)*/0
+  , /*decltype(_impl_.wait_max_us_)*/0
+  , /*decltype(_impl_.hold_p50_us_)*/0
+  , /*decltype(_impl_.hold_p99_us_)*/0
+  , /*decltype(_impl_.hold_max_us_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LockProfileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LockProfileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LockProfileDefaultTypeInternal() {}
+  union {
+    LockProfile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LockProfileDefaultTypeInternal _LockProfile_default_instance_;
+PROTOBUF_CONSTEXPR PhaseLatency::PhaseLatency(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.phase_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.priority_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.mean_ms_)*/0
+  , /*decltype(_impl_.p50_ms_)*/0
+  , /*decltype(_impl_.p90_ms_)*/0
+  , /*decltype(_impl_.p99_ms_)*/0
+  , /*decltype(_impl_.p999_ms_)*/0
+  , /*decltype(_impl_.max_ms_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PhaseLatencyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PhaseLatencyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PhaseLatencyDefaultTypeInternal() {}
+  union {
+    PhaseLatency _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PhaseLatencyDefaultTypeInternal _PhaseLatency_default_instance_;
+PROTOBUF_CONSTEXPR Metric::Metric(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bucket_bounds_)*/{}
+  , /*decltype(_impl_.bucket_counts_)*/{}
+  , /*decltype(_impl_._bucket_counts_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.labels_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.sum_)*/0
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricDefaultTypeInternal() {}
+  union {
+    Metric _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricDefaultTypeInternal _Metric_default_instance_;
+PROTOBUF_CONSTEXPR TraceRequest::TraceRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.enable_)*/false
+  , /*decltype(_impl_.collect_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TraceRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TraceRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TraceRequestDefaultTypeInternal() {}
+  union {
+    TraceRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TraceRequestDefaultTypeInternal _TraceRequest_default_instance_;
+PROTOBUF_CONSTEXPR TraceReply::TraceReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.events_json_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.events_)*/int64_t{0}
+  , /*decltype(_impl_.dropped_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TraceReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TraceReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TraceReplyDefaultTypeInternal() {}
+  union {
+    TraceReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TraceReplyDefaultTypeInternal _TraceReply_default_instance_;
 }  // namespace leader
-static ::_pb::Metadata file_level_metadata_leader_2eproto[3];
+static ::_pb::Metadata file_level_metadata_leader_2eproto[13];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_leader_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_leader_2eproto = nullptr;
 
@@ -78,6 +265,12 @@ const uint32_t TableStruct_leader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.node_id_),
   PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.score_),
   PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.queue_length_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.expected_wait_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.drain_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.backlog_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.capacity_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.service_rate_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStatus, _impl_.service_p99_ms_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::leader::Task, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -86,6 +279,34 @@ const uint32_t TableStruct_leader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::leader::Task, _impl_.task_id_),
   PROTOBUF_FIELD_OFFSET(::leader::Task, _impl_.duration_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::Task, _impl_.forwarded_),
+  PROTOBUF_FIELD_OFFSET(::leader::Task, _impl_.routing_key_),
+  PROTOBUF_FIELD_OFFSET(::leader::Task, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::leader::Task, _impl_.received_us_),
+  PROTOBUF_FIELD_OFFSET(::leader::Task, _impl_.trace_id_),
+  PROTOBUF_FIELD_OFFSET(::leader::Task, _impl_.tenant_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::StealRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::StealRequest, _impl_.node_id_),
+  PROTOBUF_FIELD_OFFSET(::leader::StealRequest, _impl_.max_tasks_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::StealReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::StealReply, _impl_.tasks_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::TaskBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::TaskBatch, _impl_.tasks_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::leader::Ack, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -93,33 +314,189 @@ const uint32_t TableStruct_leader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::leader::Ack, _impl_.message_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::StatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.node_id_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.leader_id_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.queue_length_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.backlog_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.capacity_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.tasks_completed_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.arrival_rate_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.service_rate_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.service_mean_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.service_p50_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.service_p90_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.service_p99_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.expected_wait_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.drain_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.metrics_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.latency_),
+  PROTOBUF_FIELD_OFFSET(::leader::NodeStats, _impl_.locks_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.lock_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.site_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.acquisitions_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.contended_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.wait_total_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.wait_p50_us_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.wait_p99_us_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.wait_max_us_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.hold_p50_us_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.hold_p99_us_),
+  PROTOBUF_FIELD_OFFSET(::leader::LockProfile, _impl_.hold_max_us_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.mean_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.p50_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.p90_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.p99_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.p999_ms_),
+  PROTOBUF_FIELD_OFFSET(::leader::PhaseLatency, _impl_.max_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _impl_.labels_),
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _impl_.bucket_bounds_),
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _impl_.bucket_counts_),
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _impl_.sum_),
+  PROTOBUF_FIELD_OFFSET(::leader::Metric, _impl_.count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::TraceRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::TraceRequest, _impl_.enable_),
+  PROTOBUF_FIELD_OFFSET(::leader::TraceRequest, _impl_.collect_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::leader::TraceReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::leader::TraceReply, _impl_.node_id_),
+  PROTOBUF_FIELD_OFFSET(::leader::TraceReply, _impl_.events_json_),
+  PROTOBUF_FIELD_OFFSET(::leader::TraceReply, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::leader::TraceReply, _impl_.dropped_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::leader::NodeStatus)},
-  { 9, -1, -1, sizeof(::leader::Task)},
-  { 17, -1, -1, sizeof(::leader::Ack)},
+  { 15, -1, -1, sizeof(::leader::Task)},
+  { 29, -1, -1, sizeof(::leader::StealRequest)},
+  { 37, -1, -1, sizeof(::leader::StealReply)},
+  { 44, -1, -1, sizeof(::leader::TaskBatch)},
+  { 51, -1, -1, sizeof(::leader::Ack)},
+  { 58, -1, -1, sizeof(::leader::StatsRequest)},
+  { 64, -1, -1, sizeof(::leader::NodeStats)},
+  { 87, -1, -1, sizeof(::leader::LockProfile)},
+  { 104, -1, -1, sizeof(::leader::PhaseLatency)},
+  { 119, -1, -1, sizeof(::leader::Metric)},
+  { 133, -1, -1, sizeof(::leader::TraceRequest)},
+  { 141, -1, -1, sizeof(::leader::TraceReply)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::leader::_NodeStatus_default_instance_._instance,
   &::leader::_Task_default_instance_._instance,
+  &::leader::_StealRequest_default_instance_._instance,
+  &::leader::_StealReply_default_instance_._instance,
+  &::leader::_TaskBatch_default_instance_._instance,
   &::leader::_Ack_default_instance_._instance,
+  &::leader::_StatsRequest_default_instance_._instance,
+  &::leader::_NodeStats_default_instance_._instance,
+  &::leader::_LockProfile_default_instance_._instance,
+  &::leader::_PhaseLatency_default_instance_._instance,
+  &::leader::_Metric_default_instance_._instance,
+  &::leader::_TraceRequest_default_instance_._instance,
+  &::leader::_TraceReply_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_leader_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\014leader.proto\022\006leader\"B\n\nNodeStatus\022\017\n\007"
-  "node_id\030\001 \001(\t\022\r\n\005score\030\002 \001(\002\022\024\n\014queue_le"
-  "ngth\030\003 \001(\005\",\n\004Task\022\017\n\007task_id\030\001 \001(\005\022\023\n\013d"
-  "uration_ms\030\002 \001(\005\"\026\n\003Ack\022\017\n\007message\030\001 \001(\t"
-  "2h\n\013NodeService\022.\n\tHeartbeat\022\022.leader.No"
-  "deStatus\032\013.leader.Ack\"\000\022)\n\nAssignTask\022\014."
-  "leader.Task\032\013.leader.Ack\"\000b\006proto3"
+  "\n\014leader.proto\022\006leader\"\302\001\n\nNodeStatus\022\017\n"
+  "\007node_id\030\001 \001(\t\022\r\n\005score\030\002 \001(\002\022\024\n\014queue_l"
+  "ength\030\003 \001(\005\022\030\n\020expected_wait_ms\030\004 \001(\002\022\020\n"
+  "\010drain_ms\030\005 \001(\002\022\022\n\nbacklog_ms\030\006 \001(\003\022\020\n\010c"
+  "apacity\030\007 \001(\002\022\024\n\014service_rate\030\010 \001(\002\022\026\n\016s"
+  "ervice_p99_ms\030\t \001(\002\"\235\001\n\004Task\022\017\n\007task_id\030"
+  "\001 \001(\005\022\023\n\013duration_ms\030\002 \001(\005\022\021\n\tforwarded\030"
+  "\003 \001(\010\022\023\n\013routing_key\030\004 \001(\t\022\020\n\010priority\030\005"
+  " \001(\005\022\023\n\013received_us\030\006 \001(\003\022\020\n\010trace_id\030\007 "
+  "\001(\004\022\016\n\006tenant\030\010 \001(\t\"2\n\014StealRequest\022\017\n\007n"
+  "ode_id\030\001 \001(\t\022\021\n\tmax_tasks\030\002 \001(\005\"\033\n\nSteal"
+  "Reply\022\r\n\005tasks\030\001 \001(\005\"(\n\tTaskBatch\022\033\n\005tas"
+  "ks\030\001 \003(\0132\014.leader.Task\"\026\n\003Ack\022\017\n\007message"
+  "\030\001 \001(\t\"\016\n\014StatsRequest\"\251\003\n\tNodeStats\022\017\n\007"
+  "node_id\030\001 \001(\t\022\021\n\tleader_id\030\002 \001(\t\022\024\n\014queu"
+  "e_length\030\003 \001(\005\022\022\n\nbacklog_ms\030\004 \001(\003\022\020\n\010ca"
+  "pacity\030\005 \001(\002\022\027\n\017tasks_completed\030\006 \001(\003\022\024\n"
+  "\014arrival_rate\030\007 \001(\002\022\024\n\014service_rate\030\010 \001("
+  "\002\022\027\n\017service_mean_ms\030\t \001(\002\022\026\n\016service_p5"
+  "0_ms\030\n \001(\002\022\026\n\016service_p90_ms\030\013 \001(\002\022\026\n\016se"
+  "rvice_p99_ms\030\014 \001(\002\022\030\n\020expected_wait_ms\030\r"
+  " \001(\002\022\020\n\010drain_ms\030\016 \001(\002\022\037\n\007metrics\030\017 \003(\0132"
+  "\016.leader.Metric\022%\n\007latency\030\020 \003(\0132\024.leade"
+  "r.PhaseLatency\022\"\n\005locks\030\021 \003(\0132\023.leader.L"
+  "ockProfile\"\347\001\n\013LockProfile\022\014\n\004lock\030\001 \001(\t"
+  "\022\014\n\004site\030\002 \001(\t\022\024\n\014acquisitions\030\003 \001(\003\022\021\n\t"
+  "contended\030\004 \001(\003\022\025\n\rwait_total_ms\030\005 \001(\001\022\023"
+  "\n\013wait_p50_us\030\006 \001(\002\022\023\n\013wait_p99_us\030\007 \001(\002"
+  "\022\023\n\013wait_max_us\030\010 \001(\002\022\023\n\013hold_p50_us\030\t \001"
+  "(\002\022\023\n\013hold_p99_us\030\n \001(\002\022\023\n\013hold_max_us\030\013"
+  " \001(\002\"\240\001\n\014PhaseLatency\022\r\n\005phase\030\001 \001(\t\022\020\n\010"
+  "priority\030\002 \001(\t\022\r\n\005count\030\003 \001(\004\022\017\n\007mean_ms"
+  "\030\004 \001(\002\022\016\n\006p50_ms\030\005 \001(\002\022\016\n\006p90_ms\030\006 \001(\002\022\016"
+  "\n\006p99_ms\030\007 \001(\002\022\017\n\007p999_ms\030\010 \001(\002\022\016\n\006max_m"
+  "s\030\t \001(\002\"\215\001\n\006Metric\022\014\n\004name\030\001 \001(\t\022\016\n\006labe"
+  "ls\030\002 \001(\t\022\014\n\004type\030\003 \001(\t\022\r\n\005value\030\004 \001(\001\022\025\n"
+  "\rbucket_bounds\030\005 \003(\001\022\025\n\rbucket_counts\030\006 "
+  "\003(\004\022\013\n\003sum\030\007 \001(\001\022\r\n\005count\030\010 \001(\004\"/\n\014Trace"
+  "Request\022\016\n\006enable\030\001 \001(\010\022\017\n\007collect\030\002 \001(\010"
+  "\"S\n\nTraceReply\022\017\n\007node_id\030\001 \001(\t\022\023\n\013event"
+  "s_json\030\002 \001(\t\022\016\n\006events\030\003 \001(\003\022\017\n\007dropped\030"
+  "\004 \001(\0032\277\002\n\013NodeService\022.\n\tHeartbeat\022\022.lea"
+  "der.NodeStatus\032\013.leader.Ack\"\000\022)\n\nAssignT"
+  "ask\022\014.leader.Task\032\013.leader.Ack\"\000\0228\n\nStea"
+  "lTasks\022\024.leader.StealRequest\032\022.leader.St"
+  "ealReply\"\000\022/\n\013AssignTasks\022\021.leader.TaskB"
+  "atch\032\013.leader.Ack\"\000\0225\n\010GetStats\022\024.leader"
+  ".StatsRequest\032\021.leader.NodeStats\"\000\0223\n\005Tr"
+  "ace\022\024.leader.TraceRequest\032\022.leader.Trace"
+  "Reply\"\000b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_leader_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_leader_2eproto = {
-    false, false, 274, descriptor_table_protodef_leader_2eproto,
+    false, false, 1975, descriptor_table_protodef_leader_2eproto,
     "leader.proto",
-    &descriptor_table_leader_2eproto_once, nullptr, 0, 3,
+    &descriptor_table_leader_2eproto_once, nullptr, 0, 13,
     schemas, file_default_instances, TableStruct_leader_2eproto::offsets,
     file_level_metadata_leader_2eproto, file_level_enum_descriptors_leader_2eproto,
     file_level_service_descriptors_leader_2eproto,
@@ -151,6 +528,12 @@ NodeStatus::NodeStatus(const NodeStatus& from)
       decltype(_impl_.node_id_){}
     , decltype(_impl_.score_){}
     , decltype(_impl_.queue_length_){}
+    , decltype(_impl_.expected_wait_ms_){}
+    , decltype(_impl_.drain_ms_){}
+    , decltype(_impl_.backlog_ms_){}
+    , decltype(_impl_.capacity_){}
+    , decltype(_impl_.service_rate_){}
+    , decltype(_impl_.service_p99_ms_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -163,8 +546,8 @@ NodeStatus::NodeStatus(const NodeStatus& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.score_, &from._impl_.score_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.queue_length_) -
-    reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.queue_length_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.service_p99_ms_) -
+    reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.service_p99_ms_));
   // @@protoc_insertion_point(copy_constructor:leader.NodeStatus)
 }
 
@@ -176,6 +559,12 @@ inline void NodeStatus::SharedCtor(
       decltype(_impl_.node_id_){}
     , decltype(_impl_.score_){0}
     , decltype(_impl_.queue_length_){0}
+    , decltype(_impl_.expected_wait_ms_){0}
+    , decltype(_impl_.drain_ms_){0}
+    , decltype(_impl_.backlog_ms_){int64_t{0}}
+    , decltype(_impl_.capacity_){0}
+    , decltype(_impl_.service_rate_){0}
+    , decltype(_impl_.service_p99_ms_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.node_id_.InitDefault();
@@ -210,8 +599,8 @@ void NodeStatus::Clear() {
 
   _impl_.node_id_.ClearToEmpty();
   ::memset(&_impl_.score_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.queue_length_) -
-      reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.queue_length_));
+      reinterpret_cast<char*>(&_impl_.service_p99_ms_) -
+      reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.service_p99_ms_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -247,6 +636,54 @@ const char* NodeStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
         } else
           goto handle_unusual;
         continue;
+      // float expected_wait_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.expected_wait_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float drain_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.drain_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 backlog_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.backlog_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float capacity = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float service_rate = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _impl_.service_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float service_p99_ms = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _impl_.service_p99_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -302,6 +739,62 @@ uint8_t* NodeStatus::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_queue_length(), target);
   }
 
+  // float expected_wait_ms = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_expected_wait_ms = this->_internal_expected_wait_ms();
+  uint32_t raw_expected_wait_ms;
+  memcpy(&raw_expected_wait_ms, &tmp_expected_wait_ms, sizeof(tmp_expected_wait_ms));
+  if (raw_expected_wait_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_expected_wait_ms(), target);
+  }
+
+  // float drain_ms = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_drain_ms = this->_internal_drain_ms();
+  uint32_t raw_drain_ms;
+  memcpy(&raw_drain_ms, &tmp_drain_ms, sizeof(tmp_drain_ms));
+  if (raw_drain_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_drain_ms(), target);
+  }
+
+  // int64 backlog_ms = 6;
+  if (this->_internal_backlog_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_backlog_ms(), target);
+  }
+
+  // float capacity = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_capacity = this->_internal_capacity();
+  uint32_t raw_capacity;
+  memcpy(&raw_capacity, &tmp_capacity, sizeof(tmp_capacity));
+  if (raw_capacity != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_capacity(), target);
+  }
+
+  // float service_rate = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_rate = this->_internal_service_rate();
+  uint32_t raw_service_rate;
+  memcpy(&raw_service_rate, &tmp_service_rate, sizeof(tmp_service_rate));
+  if (raw_service_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_service_rate(), target);
+  }
+
+  // float service_p99_ms = 9;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p99_ms = this->_internal_service_p99_ms();
+  uint32_t raw_service_p99_ms;
+  memcpy(&raw_service_p99_ms, &tmp_service_p99_ms, sizeof(tmp_service_p99_ms));
+  if (raw_service_p99_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_service_p99_ms(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -339,6 +832,56 @@ size_t NodeStatus::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_queue_length());
   }
 
+  // float expected_wait_ms = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_expected_wait_ms = this->_internal_expected_wait_ms();
+  uint32_t raw_expected_wait_ms;
+  memcpy(&raw_expected_wait_ms, &tmp_expected_wait_ms, sizeof(tmp_expected_wait_ms));
+  if (raw_expected_wait_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float drain_ms = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_drain_ms = this->_internal_drain_ms();
+  uint32_t raw_drain_ms;
+  memcpy(&raw_drain_ms, &tmp_drain_ms, sizeof(tmp_drain_ms));
+  if (raw_drain_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // int64 backlog_ms = 6;
+  if (this->_internal_backlog_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_backlog_ms());
+  }
+
+  // float capacity = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_capacity = this->_internal_capacity();
+  uint32_t raw_capacity;
+  memcpy(&raw_capacity, &tmp_capacity, sizeof(tmp_capacity));
+  if (raw_capacity != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float service_rate = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_rate = this->_internal_service_rate();
+  uint32_t raw_service_rate;
+  memcpy(&raw_service_rate, &tmp_service_rate, sizeof(tmp_service_rate));
+  if (raw_service_rate != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float service_p99_ms = 9;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p99_ms = this->_internal_service_p99_ms();
+  uint32_t raw_service_p99_ms;
+  memcpy(&raw_service_p99_ms, &tmp_service_p99_ms, sizeof(tmp_service_p99_ms));
+  if (raw_service_p99_ms != 0) {
+    total_size += 1 + 4;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -370,6 +913,44 @@ void NodeStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PRO
   if (from._internal_queue_length() != 0) {
     _this->_internal_set_queue_length(from._internal_queue_length());
   }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_expected_wait_ms = from._internal_expected_wait_ms();
+  uint32_t raw_expected_wait_ms;
+  memcpy(&raw_expected_wait_ms, &tmp_expected_wait_ms, sizeof(tmp_expected_wait_ms));
+  if (raw_expected_wait_ms != 0) {
+    _this->_internal_set_expected_wait_ms(from._internal_expected_wait_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_drain_ms = from._internal_drain_ms();
+  uint32_t raw_drain_ms;
+  memcpy(&raw_drain_ms, &tmp_drain_ms, sizeof(tmp_drain_ms));
+  if (raw_drain_ms != 0) {
+    _this->_internal_set_drain_ms(from._internal_drain_ms());
+  }
+  if (from._internal_backlog_ms() != 0) {
+    _this->_internal_set_backlog_ms(from._internal_backlog_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_capacity = from._internal_capacity();
+  uint32_t raw_capacity;
+  memcpy(&raw_capacity, &tmp_capacity, sizeof(tmp_capacity));
+  if (raw_capacity != 0) {
+    _this->_internal_set_capacity(from._internal_capacity());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_rate = from._internal_service_rate();
+  uint32_t raw_service_rate;
+  memcpy(&raw_service_rate, &tmp_service_rate, sizeof(tmp_service_rate));
+  if (raw_service_rate != 0) {
+    _this->_internal_set_service_rate(from._internal_service_rate());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p99_ms = from._internal_service_p99_ms();
+  uint32_t raw_service_p99_ms;
+  memcpy(&raw_service_p99_ms, &tmp_service_p99_ms, sizeof(tmp_service_p99_ms));
+  if (raw_service_p99_ms != 0) {
+    _this->_internal_set_service_p99_ms(from._internal_service_p99_ms());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -394,8 +975,8 @@ void NodeStatus::InternalSwap(NodeStatus* other) {
       &other->_impl_.node_id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.queue_length_)
-      + sizeof(NodeStatus::_impl_.queue_length_)
+      PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.service_p99_ms_)
+      + sizeof(NodeStatus::_impl_.service_p99_ms_)
       - PROTOBUF_FIELD_OFFSET(NodeStatus, _impl_.score_)>(
           reinterpret_cast<char*>(&_impl_.score_),
           reinterpret_cast<char*>(&other->_impl_.score_));
@@ -423,14 +1004,36 @@ Task::Task(const Task& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   Task* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.task_id_){}
+      decltype(_impl_.routing_key_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.task_id_){}
     , decltype(_impl_.duration_ms_){}
+    , decltype(_impl_.forwarded_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.received_us_){}
+    , decltype(_impl_.trace_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.routing_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.routing_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_routing_key().empty()) {
+    _this->_impl_.routing_key_.Set(from._internal_routing_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tenant().empty()) {
+    _this->_impl_.tenant_.Set(from._internal_tenant(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.task_id_, &from._impl_.task_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.duration_ms_) -
-    reinterpret_cast<char*>(&_impl_.task_id_)) + sizeof(_impl_.duration_ms_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.trace_id_) -
+    reinterpret_cast<char*>(&_impl_.task_id_)) + sizeof(_impl_.trace_id_));
   // @@protoc_insertion_point(copy_constructor:leader.Task)
 }
 
@@ -439,10 +1042,24 @@ inline void Task::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.task_id_){0}
+      decltype(_impl_.routing_key_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.task_id_){0}
     , decltype(_impl_.duration_ms_){0}
+    , decltype(_impl_.forwarded_){false}
+    , decltype(_impl_.priority_){0}
+    , decltype(_impl_.received_us_){int64_t{0}}
+    , decltype(_impl_.trace_id_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.routing_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.routing_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Task::~Task() {
@@ -456,6 +1073,8 @@ Task::~Task() {
 
 inline void Task::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.routing_key_.Destroy();
+  _impl_.tenant_.Destroy();
 }
 
 void Task::SetCachedSize(int size) const {
@@ -468,9 +1087,11 @@ void Task::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.routing_key_.ClearToEmpty();
+  _impl_.tenant_.ClearToEmpty();
   ::memset(&_impl_.task_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.duration_ms_) -
-      reinterpret_cast<char*>(&_impl_.task_id_)) + sizeof(_impl_.duration_ms_));
+      reinterpret_cast<char*>(&_impl_.trace_id_) -
+      reinterpret_cast<char*>(&_impl_.task_id_)) + sizeof(_impl_.trace_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -496,6 +1117,58 @@ const char* Task::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // bool forwarded = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.forwarded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string routing_key = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_routing_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.Task.routing_key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 priority = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.priority_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 received_us = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.received_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 trace_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.trace_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string tenant = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_tenant();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.Task.tenant"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -537,6 +1210,50 @@ uint8_t* Task::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_duration_ms(), target);
   }
 
+  // bool forwarded = 3;
+  if (this->_internal_forwarded() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_forwarded(), target);
+  }
+
+  // string routing_key = 4;
+  if (!this->_internal_routing_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_routing_key().data(), static_cast<int>(this->_internal_routing_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.Task.routing_key");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_routing_key(), target);
+  }
+
+  // int32 priority = 5;
+  if (this->_internal_priority() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_priority(), target);
+  }
+
+  // int64 received_us = 6;
+  if (this->_internal_received_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_received_us(), target);
+  }
+
+  // uint64 trace_id = 7;
+  if (this->_internal_trace_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_trace_id(), target);
+  }
+
+  // string tenant = 8;
+  if (!this->_internal_tenant().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_tenant().data(), static_cast<int>(this->_internal_tenant().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.Task.tenant");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_tenant(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -553,9 +1270,23 @@ size_t Task::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 task_id = 1;
-  if (this->_internal_task_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_task_id());
+  // string routing_key = 4;
+  if (!this->_internal_routing_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_routing_key());
+  }
+
+  // string tenant = 8;
+  if (!this->_internal_tenant().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_tenant());
+  }
+
+  // int32 task_id = 1;
+  if (this->_internal_task_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_task_id());
   }
 
   // int32 duration_ms = 2;
@@ -563,6 +1294,26 @@ size_t Task::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_duration_ms());
   }
 
+  // bool forwarded = 3;
+  if (this->_internal_forwarded() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 priority = 5;
+  if (this->_internal_priority() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_priority());
+  }
+
+  // int64 received_us = 6;
+  if (this->_internal_received_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_us());
+  }
+
+  // uint64 trace_id = 7;
+  if (this->_internal_trace_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_trace_id());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -581,12 +1332,30 @@ void Task::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (!from._internal_routing_key().empty()) {
+    _this->_internal_set_routing_key(from._internal_routing_key());
+  }
+  if (!from._internal_tenant().empty()) {
+    _this->_internal_set_tenant(from._internal_tenant());
+  }
   if (from._internal_task_id() != 0) {
     _this->_internal_set_task_id(from._internal_task_id());
   }
   if (from._internal_duration_ms() != 0) {
     _this->_internal_set_duration_ms(from._internal_duration_ms());
   }
+  if (from._internal_forwarded() != 0) {
+    _this->_internal_set_forwarded(from._internal_forwarded());
+  }
+  if (from._internal_priority() != 0) {
+    _this->_internal_set_priority(from._internal_priority());
+  }
+  if (from._internal_received_us() != 0) {
+    _this->_internal_set_received_us(from._internal_received_us());
+  }
+  if (from._internal_trace_id() != 0) {
+    _this->_internal_set_trace_id(from._internal_trace_id());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -603,10 +1372,20 @@ bool Task::IsInitialized() const {
 
 void Task::InternalSwap(Task* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.routing_key_, lhs_arena,
+      &other->_impl_.routing_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tenant_, lhs_arena,
+      &other->_impl_.tenant_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Task, _impl_.duration_ms_)
-      + sizeof(Task::_impl_.duration_ms_)
+      PROTOBUF_FIELD_OFFSET(Task, _impl_.trace_id_)
+      + sizeof(Task::_impl_.trace_id_)
       - PROTOBUF_FIELD_OFFSET(Task, _impl_.task_id_)>(
           reinterpret_cast<char*>(&_impl_.task_id_),
           reinterpret_cast<char*>(&other->_impl_.task_id_));
@@ -620,51 +1399,54 @@ void Task::InternalSwap(Task* other) {
 
 // ===================================================================
 
-class Ack::_Internal {
+class StealRequest::_Internal {
  public:
 };
 
-Ack::Ack(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+StealRequest::StealRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:leader.Ack)
+  // @@protoc_insertion_point(arena_constructor:leader.StealRequest)
 }
-Ack::Ack(const Ack& from)
+StealRequest::StealRequest(const StealRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Ack* const _this = this; (void)_this;
+  StealRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.message_){}
+      decltype(_impl_.node_id_){}
+    , decltype(_impl_.max_tasks_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.message_.InitDefault();
+  _impl_.node_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.message_.Set("", GetArenaForAllocation());
+    _impl_.node_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_message().empty()) {
-    _this->_impl_.message_.Set(from._internal_message(), 
+  if (!from._internal_node_id().empty()) {
+    _this->_impl_.node_id_.Set(from._internal_node_id(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:leader.Ack)
+  _this->_impl_.max_tasks_ = from._impl_.max_tasks_;
+  // @@protoc_insertion_point(copy_constructor:leader.StealRequest)
 }
 
-inline void Ack::SharedCtor(
+inline void StealRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.message_){}
+      decltype(_impl_.node_id_){}
+    , decltype(_impl_.max_tasks_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.message_.InitDefault();
+  _impl_.node_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.message_.Set("", GetArenaForAllocation());
+    _impl_.node_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Ack::~Ack() {
-  // @@protoc_insertion_point(destructor:leader.Ack)
+StealRequest::~StealRequest() {
+  // @@protoc_insertion_point(destructor:leader.StealRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -672,38 +1454,47 @@ Ack::~Ack() {
   SharedDtor();
 }
 
-inline void Ack::SharedDtor() {
+inline void StealRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.message_.Destroy();
+  _impl_.node_id_.Destroy();
 }
 
-void Ack::SetCachedSize(int size) const {
+void StealRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Ack::Clear() {
-// @@protoc_insertion_point(message_clear_start:leader.Ack)
+void StealRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.StealRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.message_.ClearToEmpty();
+  _impl_.node_id_.ClearToEmpty();
+  _impl_.max_tasks_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Ack::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* StealRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string message = 1;
+      // string node_id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_message();
+          auto str = _internal_mutable_node_id();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "leader.Ack.message"));
+          CHK_(::_pbi::VerifyUTF8(str, "leader.StealRequest.node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_tasks = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_tasks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -730,111 +1521,3615 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Ack::_InternalSerialize(
+uint8_t* StealRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:leader.Ack)
+  // @@protoc_insertion_point(serialize_to_array_start:leader.StealRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string message = 1;
-  if (!this->_internal_message().empty()) {
+  // string node_id = 1;
+  if (!this->_internal_node_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      this->_internal_node_id().data(), static_cast<int>(this->_internal_node_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "leader.Ack.message");
+      "leader.StealRequest.node_id");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_message(), target);
+        1, this->_internal_node_id(), target);
+  }
+
+  // int32 max_tasks = 2;
+  if (this->_internal_max_tasks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_tasks(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:leader.Ack)
+  // @@protoc_insertion_point(serialize_to_array_end:leader.StealRequest)
   return target;
 }
 
-size_t Ack::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:leader.Ack)
+size_t StealRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.StealRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string message = 1;
-  if (!this->_internal_message().empty()) {
+  // string node_id = 1;
+  if (!this->_internal_node_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message());
+        this->_internal_node_id());
+  }
+
+  // int32 max_tasks = 2;
+  if (this->_internal_max_tasks() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_tasks());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Ack::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StealRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Ack::MergeImpl
+    StealRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Ack::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StealRequest::GetClassData() const { return &_class_data_; }
 
 
-void Ack::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Ack*>(&to_msg);
-  auto& from = static_cast<const Ack&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:leader.Ack)
+void StealRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StealRequest*>(&to_msg);
+  auto& from = static_cast<const StealRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.StealRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_message().empty()) {
-    _this->_internal_set_message(from._internal_message());
+  if (!from._internal_node_id().empty()) {
+    _this->_internal_set_node_id(from._internal_node_id());
+  }
+  if (from._internal_max_tasks() != 0) {
+    _this->_internal_set_max_tasks(from._internal_max_tasks());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Ack::CopyFrom(const Ack& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:leader.Ack)
+void StealRequest::CopyFrom(const StealRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.StealRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Ack::IsInitialized() const {
+bool StealRequest::IsInitialized() const {
   return true;
 }
 
-void Ack::InternalSwap(Ack* other) {
+void StealRequest::InternalSwap(StealRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.message_, lhs_arena,
-      &other->_impl_.message_, rhs_arena
+      &_impl_.node_id_, lhs_arena,
+      &other->_impl_.node_id_, rhs_arena
   );
+  swap(_impl_.max_tasks_, other->_impl_.max_tasks_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Ack::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata StealRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
       file_level_metadata_leader_2eproto[2]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace leader
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::leader::NodeStatus*
-Arena::CreateMaybeMessage< ::leader::NodeStatus >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::leader::NodeStatus >(arena);
+// ===================================================================
+
+class StealReply::_Internal {
+ public:
+};
+
+StealReply::StealReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.StealReply)
 }
-template<> PROTOBUF_NOINLINE ::leader::Task*
-Arena::CreateMaybeMessage< ::leader::Task >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::leader::Task >(arena);
+StealReply::StealReply(const StealReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StealReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tasks_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.tasks_ = from._impl_.tasks_;
+  // @@protoc_insertion_point(copy_constructor:leader.StealReply)
 }
-template<> PROTOBUF_NOINLINE ::leader::Ack*
-Arena::CreateMaybeMessage< ::leader::Ack >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::leader::Ack >(arena);
+
+inline void StealReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tasks_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StealReply::~StealReply() {
+  // @@protoc_insertion_point(destructor:leader.StealReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StealReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StealReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StealReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.StealReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tasks_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StealReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 tasks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.tasks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StealReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.StealReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 tasks = 1;
+  if (this->_internal_tasks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_tasks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.StealReply)
+  return target;
+}
+
+size_t StealReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.StealReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 tasks = 1;
+  if (this->_internal_tasks() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tasks());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StealReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StealReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StealReply::GetClassData() const { return &_class_data_; }
+
+
+void StealReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StealReply*>(&to_msg);
+  auto& from = static_cast<const StealReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.StealReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_tasks() != 0) {
+    _this->_internal_set_tasks(from._internal_tasks());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StealReply::CopyFrom(const StealReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.StealReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StealReply::IsInitialized() const {
+  return true;
+}
+
+void StealReply::InternalSwap(StealReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.tasks_, other->_impl_.tasks_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StealReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[3]);
+}
+
+// ===================================================================
+
+class TaskBatch::_Internal {
+ public:
+};
+
+TaskBatch::TaskBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.TaskBatch)
+}
+TaskBatch::TaskBatch(const TaskBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TaskBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tasks_){from._impl_.tasks_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:leader.TaskBatch)
+}
+
+inline void TaskBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tasks_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TaskBatch::~TaskBatch() {
+  // @@protoc_insertion_point(destructor:leader.TaskBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TaskBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tasks_.~RepeatedPtrField();
+}
+
+void TaskBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TaskBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.TaskBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tasks_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TaskBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .leader.Task tasks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tasks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TaskBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.TaskBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .leader.Task tasks = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tasks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tasks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.TaskBatch)
+  return target;
+}
+
+size_t TaskBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.TaskBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .leader.Task tasks = 1;
+  total_size += 1UL * this->_internal_tasks_size();
+  for (const auto& msg : this->_impl_.tasks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TaskBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TaskBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TaskBatch::GetClassData() const { return &_class_data_; }
+
+
+void TaskBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TaskBatch*>(&to_msg);
+  auto& from = static_cast<const TaskBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.TaskBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tasks_.MergeFrom(from._impl_.tasks_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TaskBatch::CopyFrom(const TaskBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.TaskBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TaskBatch::IsInitialized() const {
+  return true;
+}
+
+void TaskBatch::InternalSwap(TaskBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.tasks_.InternalSwap(&other->_impl_.tasks_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TaskBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[4]);
+}
+
+// ===================================================================
+
+class Ack::_Internal {
+ public:
+};
+
+Ack::Ack(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.Ack)
+}
+Ack::Ack(const Ack& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Ack* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:leader.Ack)
+}
+
+inline void Ack::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Ack::~Ack() {
+  // @@protoc_insertion_point(destructor:leader.Ack)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Ack::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+}
+
+void Ack::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Ack::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.Ack)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Ack::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.Ack.message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Ack::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.Ack)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string message = 1;
+  if (!this->_internal_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.Ack.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.Ack)
+  return target;
+}
+
+size_t Ack::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.Ack)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string message = 1;
+  if (!this->_internal_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Ack::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Ack::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Ack::GetClassData() const { return &_class_data_; }
+
+
+void Ack::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Ack*>(&to_msg);
+  auto& from = static_cast<const Ack&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.Ack)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Ack::CopyFrom(const Ack& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.Ack)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Ack::IsInitialized() const {
+  return true;
+}
+
+void Ack::InternalSwap(Ack* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Ack::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[5]);
+}
+
+// ===================================================================
+
+class StatsRequest::_Internal {
+ public:
+};
+
+StatsRequest::StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:leader.StatsRequest)
+}
+StatsRequest::StatsRequest(const StatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  StatsRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:leader.StatsRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[6]);
+}
+
+// ===================================================================
+
+class NodeStats::_Internal {
+ public:
+};
+
+NodeStats::NodeStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.NodeStats)
+}
+NodeStats::NodeStats(const NodeStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metrics_){from._impl_.metrics_}
+    , decltype(_impl_.latency_){from._impl_.latency_}
+    , decltype(_impl_.locks_){from._impl_.locks_}
+    , decltype(_impl_.node_id_){}
+    , decltype(_impl_.leader_id_){}
+    , decltype(_impl_.backlog_ms_){}
+    , decltype(_impl_.queue_length_){}
+    , decltype(_impl_.capacity_){}
+    , decltype(_impl_.tasks_completed_){}
+    , decltype(_impl_.arrival_rate_){}
+    , decltype(_impl_.service_rate_){}
+    , decltype(_impl_.service_mean_ms_){}
+    , decltype(_impl_.service_p50_ms_){}
+    , decltype(_impl_.service_p90_ms_){}
+    , decltype(_impl_.service_p99_ms_){}
+    , decltype(_impl_.expected_wait_ms_){}
+    , decltype(_impl_.drain_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node_id().empty()) {
+    _this->_impl_.node_id_.Set(from._internal_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.leader_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_leader_id().empty()) {
+    _this->_impl_.leader_id_.Set(from._internal_leader_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.backlog_ms_, &from._impl_.backlog_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.drain_ms_) -
+    reinterpret_cast<char*>(&_impl_.backlog_ms_)) + sizeof(_impl_.drain_ms_));
+  // @@protoc_insertion_point(copy_constructor:leader.NodeStats)
+}
+
+inline void NodeStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metrics_){arena}
+    , decltype(_impl_.latency_){arena}
+    , decltype(_impl_.locks_){arena}
+    , decltype(_impl_.node_id_){}
+    , decltype(_impl_.leader_id_){}
+    , decltype(_impl_.backlog_ms_){int64_t{0}}
+    , decltype(_impl_.queue_length_){0}
+    , decltype(_impl_.capacity_){0}
+    , decltype(_impl_.tasks_completed_){int64_t{0}}
+    , decltype(_impl_.arrival_rate_){0}
+    , decltype(_impl_.service_rate_){0}
+    , decltype(_impl_.service_mean_ms_){0}
+    , decltype(_impl_.service_p50_ms_){0}
+    , decltype(_impl_.service_p90_ms_){0}
+    , decltype(_impl_.service_p99_ms_){0}
+    , decltype(_impl_.expected_wait_ms_){0}
+    , decltype(_impl_.drain_ms_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.leader_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NodeStats::~NodeStats() {
+  // @@protoc_insertion_point(destructor:leader.NodeStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NodeStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.metrics_.~RepeatedPtrField();
+  _impl_.latency_.~RepeatedPtrField();
+  _impl_.locks_.~RepeatedPtrField();
+  _impl_.node_id_.Destroy();
+  _impl_.leader_id_.Destroy();
+}
+
+void NodeStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NodeStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.NodeStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.metrics_.Clear();
+  _impl_.latency_.Clear();
+  _impl_.locks_.Clear();
+  _impl_.node_id_.ClearToEmpty();
+  _impl_.leader_id_.ClearToEmpty();
+  ::memset(&_impl_.backlog_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.drain_ms_) -
+      reinterpret_cast<char*>(&_impl_.backlog_ms_)) + sizeof(_impl_.drain_ms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string node_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.NodeStats.node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string leader_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_leader_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.NodeStats.leader_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 queue_length = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.queue_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 backlog_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.backlog_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float capacity = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 tasks_completed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.tasks_completed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float arrival_rate = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.arrival_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float service_rate = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _impl_.service_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float service_mean_ms = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _impl_.service_mean_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float service_p50_ms = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _impl_.service_p50_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float service_p90_ms = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _impl_.service_p90_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float service_p99_ms = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 101)) {
+          _impl_.service_p99_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float expected_wait_ms = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 109)) {
+          _impl_.expected_wait_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float drain_ms = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 117)) {
+          _impl_.drain_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .leader.Metric metrics = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_metrics(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<122>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .leader.PhaseLatency latency = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_latency(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<130>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .leader.LockProfile locks = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_locks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<138>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.NodeStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string node_id = 1;
+  if (!this->_internal_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node_id().data(), static_cast<int>(this->_internal_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.NodeStats.node_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_node_id(), target);
+  }
+
+  // string leader_id = 2;
+  if (!this->_internal_leader_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_leader_id().data(), static_cast<int>(this->_internal_leader_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.NodeStats.leader_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_leader_id(), target);
+  }
+
+  // int32 queue_length = 3;
+  if (this->_internal_queue_length() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_queue_length(), target);
+  }
+
+  // int64 backlog_ms = 4;
+  if (this->_internal_backlog_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_backlog_ms(), target);
+  }
+
+  // float capacity = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_capacity = this->_internal_capacity();
+  uint32_t raw_capacity;
+  memcpy(&raw_capacity, &tmp_capacity, sizeof(tmp_capacity));
+  if (raw_capacity != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_capacity(), target);
+  }
+
+  // int64 tasks_completed = 6;
+  if (this->_internal_tasks_completed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_tasks_completed(), target);
+  }
+
+  // float arrival_rate = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_arrival_rate = this->_internal_arrival_rate();
+  uint32_t raw_arrival_rate;
+  memcpy(&raw_arrival_rate, &tmp_arrival_rate, sizeof(tmp_arrival_rate));
+  if (raw_arrival_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_arrival_rate(), target);
+  }
+
+  // float service_rate = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_rate = this->_internal_service_rate();
+  uint32_t raw_service_rate;
+  memcpy(&raw_service_rate, &tmp_service_rate, sizeof(tmp_service_rate));
+  if (raw_service_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_service_rate(), target);
+  }
+
+  // float service_mean_ms = 9;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_mean_ms = this->_internal_service_mean_ms();
+  uint32_t raw_service_mean_ms;
+  memcpy(&raw_service_mean_ms, &tmp_service_mean_ms, sizeof(tmp_service_mean_ms));
+  if (raw_service_mean_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_service_mean_ms(), target);
+  }
+
+  // float service_p50_ms = 10;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p50_ms = this->_internal_service_p50_ms();
+  uint32_t raw_service_p50_ms;
+  memcpy(&raw_service_p50_ms, &tmp_service_p50_ms, sizeof(tmp_service_p50_ms));
+  if (raw_service_p50_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_service_p50_ms(), target);
+  }
+
+  // float service_p90_ms = 11;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p90_ms = this->_internal_service_p90_ms();
+  uint32_t raw_service_p90_ms;
+  memcpy(&raw_service_p90_ms, &tmp_service_p90_ms, sizeof(tmp_service_p90_ms));
+  if (raw_service_p90_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_service_p90_ms(), target);
+  }
+
+  // float service_p99_ms = 12;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p99_ms = this->_internal_service_p99_ms();
+  uint32_t raw_service_p99_ms;
+  memcpy(&raw_service_p99_ms, &tmp_service_p99_ms, sizeof(tmp_service_p99_ms));
+  if (raw_service_p99_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(12, this->_internal_service_p99_ms(), target);
+  }
+
+  // float expected_wait_ms = 13;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_expected_wait_ms = this->_internal_expected_wait_ms();
+  uint32_t raw_expected_wait_ms;
+  memcpy(&raw_expected_wait_ms, &tmp_expected_wait_ms, sizeof(tmp_expected_wait_ms));
+  if (raw_expected_wait_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(13, this->_internal_expected_wait_ms(), target);
+  }
+
+  // float drain_ms = 14;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_drain_ms = this->_internal_drain_ms();
+  uint32_t raw_drain_ms;
+  memcpy(&raw_drain_ms, &tmp_drain_ms, sizeof(tmp_drain_ms));
+  if (raw_drain_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(14, this->_internal_drain_ms(), target);
+  }
+
+  // repeated .leader.Metric metrics = 15;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_metrics_size()); i < n; i++) {
+    const auto& repfield = this->_internal_metrics(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(15, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .leader.PhaseLatency latency = 16;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_latency_size()); i < n; i++) {
+    const auto& repfield = this->_internal_latency(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(16, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .leader.LockProfile locks = 17;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_locks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_locks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(17, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.NodeStats)
+  return target;
+}
+
+size_t NodeStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.NodeStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .leader.Metric metrics = 15;
+  total_size += 1UL * this->_internal_metrics_size();
+  for (const auto& msg : this->_impl_.metrics_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .leader.PhaseLatency latency = 16;
+  total_size += 2UL * this->_internal_latency_size();
+  for (const auto& msg : this->_impl_.latency_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .leader.LockProfile locks = 17;
+  total_size += 2UL * this->_internal_locks_size();
+  for (const auto& msg : this->_impl_.locks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string node_id = 1;
+  if (!this->_internal_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node_id());
+  }
+
+  // string leader_id = 2;
+  if (!this->_internal_leader_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_leader_id());
+  }
+
+  // int64 backlog_ms = 4;
+  if (this->_internal_backlog_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_backlog_ms());
+  }
+
+  // int32 queue_length = 3;
+  if (this->_internal_queue_length() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_queue_length());
+  }
+
+  // float capacity = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_capacity = this->_internal_capacity();
+  uint32_t raw_capacity;
+  memcpy(&raw_capacity, &tmp_capacity, sizeof(tmp_capacity));
+  if (raw_capacity != 0) {
+    total_size += 1 + 4;
+  }
+
+  // int64 tasks_completed = 6;
+  if (this->_internal_tasks_completed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_tasks_completed());
+  }
+
+  // float arrival_rate = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_arrival_rate = this->_internal_arrival_rate();
+  uint32_t raw_arrival_rate;
+  memcpy(&raw_arrival_rate, &tmp_arrival_rate, sizeof(tmp_arrival_rate));
+  if (raw_arrival_rate != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float service_rate = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_rate = this->_internal_service_rate();
+  uint32_t raw_service_rate;
+  memcpy(&raw_service_rate, &tmp_service_rate, sizeof(tmp_service_rate));
+  if (raw_service_rate != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float service_mean_ms = 9;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_mean_ms = this->_internal_service_mean_ms();
+  uint32_t raw_service_mean_ms;
+  memcpy(&raw_service_mean_ms, &tmp_service_mean_ms, sizeof(tmp_service_mean_ms));
+  if (raw_service_mean_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float service_p50_ms = 10;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p50_ms = this->_internal_service_p50_ms();
+  uint32_t raw_service_p50_ms;
+  memcpy(&raw_service_p50_ms, &tmp_service_p50_ms, sizeof(tmp_service_p50_ms));
+  if (raw_service_p50_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float service_p90_ms = 11;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p90_ms = this->_internal_service_p90_ms();
+  uint32_t raw_service_p90_ms;
+  memcpy(&raw_service_p90_ms, &tmp_service_p90_ms, sizeof(tmp_service_p90_ms));
+  if (raw_service_p90_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float service_p99_ms = 12;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p99_ms = this->_internal_service_p99_ms();
+  uint32_t raw_service_p99_ms;
+  memcpy(&raw_service_p99_ms, &tmp_service_p99_ms, sizeof(tmp_service_p99_ms));
+  if (raw_service_p99_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float expected_wait_ms = 13;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_expected_wait_ms = this->_internal_expected_wait_ms();
+  uint32_t raw_expected_wait_ms;
+  memcpy(&raw_expected_wait_ms, &tmp_expected_wait_ms, sizeof(tmp_expected_wait_ms));
+  if (raw_expected_wait_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float drain_ms = 14;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_drain_ms = this->_internal_drain_ms();
+  uint32_t raw_drain_ms;
+  memcpy(&raw_drain_ms, &tmp_drain_ms, sizeof(tmp_drain_ms));
+  if (raw_drain_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeStats::GetClassData() const { return &_class_data_; }
+
+
+void NodeStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeStats*>(&to_msg);
+  auto& from = static_cast<const NodeStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.NodeStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.metrics_.MergeFrom(from._impl_.metrics_);
+  _this->_impl_.latency_.MergeFrom(from._impl_.latency_);
+  _this->_impl_.locks_.MergeFrom(from._impl_.locks_);
+  if (!from._internal_node_id().empty()) {
+    _this->_internal_set_node_id(from._internal_node_id());
+  }
+  if (!from._internal_leader_id().empty()) {
+    _this->_internal_set_leader_id(from._internal_leader_id());
+  }
+  if (from._internal_backlog_ms() != 0) {
+    _this->_internal_set_backlog_ms(from._internal_backlog_ms());
+  }
+  if (from._internal_queue_length() != 0) {
+    _this->_internal_set_queue_length(from._internal_queue_length());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_capacity = from._internal_capacity();
+  uint32_t raw_capacity;
+  memcpy(&raw_capacity, &tmp_capacity, sizeof(tmp_capacity));
+  if (raw_capacity != 0) {
+    _this->_internal_set_capacity(from._internal_capacity());
+  }
+  if (from._internal_tasks_completed() != 0) {
+    _this->_internal_set_tasks_completed(from._internal_tasks_completed());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_arrival_rate = from._internal_arrival_rate();
+  uint32_t raw_arrival_rate;
+  memcpy(&raw_arrival_rate, &tmp_arrival_rate, sizeof(tmp_arrival_rate));
+  if (raw_arrival_rate != 0) {
+    _this->_internal_set_arrival_rate(from._internal_arrival_rate());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_rate = from._internal_service_rate();
+  uint32_t raw_service_rate;
+  memcpy(&raw_service_rate, &tmp_service_rate, sizeof(tmp_service_rate));
+  if (raw_service_rate != 0) {
+    _this->_internal_set_service_rate(from._internal_service_rate());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_mean_ms = from._internal_service_mean_ms();
+  uint32_t raw_service_mean_ms;
+  memcpy(&raw_service_mean_ms, &tmp_service_mean_ms, sizeof(tmp_service_mean_ms));
+  if (raw_service_mean_ms != 0) {
+    _this->_internal_set_service_mean_ms(from._internal_service_mean_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p50_ms = from._internal_service_p50_ms();
+  uint32_t raw_service_p50_ms;
+  memcpy(&raw_service_p50_ms, &tmp_service_p50_ms, sizeof(tmp_service_p50_ms));
+  if (raw_service_p50_ms != 0) {
+    _this->_internal_set_service_p50_ms(from._internal_service_p50_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p90_ms = from._internal_service_p90_ms();
+  uint32_t raw_service_p90_ms;
+  memcpy(&raw_service_p90_ms, &tmp_service_p90_ms, sizeof(tmp_service_p90_ms));
+  if (raw_service_p90_ms != 0) {
+    _this->_internal_set_service_p90_ms(from._internal_service_p90_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_service_p99_ms = from._internal_service_p99_ms();
+  uint32_t raw_service_p99_ms;
+  memcpy(&raw_service_p99_ms, &tmp_service_p99_ms, sizeof(tmp_service_p99_ms));
+  if (raw_service_p99_ms != 0) {
+    _this->_internal_set_service_p99_ms(from._internal_service_p99_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_expected_wait_ms = from._internal_expected_wait_ms();
+  uint32_t raw_expected_wait_ms;
+  memcpy(&raw_expected_wait_ms, &tmp_expected_wait_ms, sizeof(tmp_expected_wait_ms));
+  if (raw_expected_wait_ms != 0) {
+    _this->_internal_set_expected_wait_ms(from._internal_expected_wait_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_drain_ms = from._internal_drain_ms();
+  uint32_t raw_drain_ms;
+  memcpy(&raw_drain_ms, &tmp_drain_ms, sizeof(tmp_drain_ms));
+  if (raw_drain_ms != 0) {
+    _this->_internal_set_drain_ms(from._internal_drain_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NodeStats::CopyFrom(const NodeStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.NodeStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeStats::IsInitialized() const {
+  return true;
+}
+
+void NodeStats::InternalSwap(NodeStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.metrics_.InternalSwap(&other->_impl_.metrics_);
+  _impl_.latency_.InternalSwap(&other->_impl_.latency_);
+  _impl_.locks_.InternalSwap(&other->_impl_.locks_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_id_, lhs_arena,
+      &other->_impl_.node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.leader_id_, lhs_arena,
+      &other->_impl_.leader_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeStats, _impl_.drain_ms_)
+      + sizeof(NodeStats::_impl_.drain_ms_)
+      - PROTOBUF_FIELD_OFFSET(NodeStats, _impl_.backlog_ms_)>(
+          reinterpret_cast<char*>(&_impl_.backlog_ms_),
+          reinterpret_cast<char*>(&other->_impl_.backlog_ms_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NodeStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[7]);
+}
+
+// ===================================================================
+
+class LockProfile::_Internal {
+ public:
+};
+
+LockProfile::LockProfile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.LockProfile)
+}
+LockProfile::LockProfile(const LockProfile& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LockProfile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lock_){}
+    , decltype(_impl_.site_){}
+    , decltype(_impl_.acquisitions_){}
+    , decltype(_impl_.contended_){}
+    , decltype(_impl_.wait_total_ms_){}
+    , decltype(_impl_.wait_p50_us_){}
+    , decltype(_impl_.wait_p99_us_){}
+    , decltype(_impl_.wait_max_us_){}
+    , decltype(_impl_.hold_p50_us_){}
+    , decltype(_impl_.hold_p99_us_){}
+    , decltype(_impl_.hold_max_us_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.lock_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lock_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_lock().empty()) {
+    _this->_impl_.lock_.Set(from._internal_lock(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.site_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.site_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_site().empty()) {
+    _this->_impl_.site_.Set(from._internal_site(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.acquisitions_, &from._impl_.acquisitions_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.hold_max_us_) -
+    reinterpret_cast<char*>(&_impl_.acquisitions_)) + sizeof(_impl_.hold_max_us_));
+  // @@protoc_insertion_point(copy_constructor:leader.LockProfile)
+}
+
+inline void LockProfile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lock_){}
+    , decltype(_impl_.site_){}
+    , decltype(_impl_.acquisitions_){int64_t{0}}
+    , decltype(_impl_.contended_){int64_t{0}}
+    , decltype(_impl_.wait_total_ms_){0}
+    , decltype(_impl_.wait_p50_us_){0}
+    , decltype(_impl_.wait_p99_us_){0}
+    , decltype(_impl_.wait_max_us_){0}
+    , decltype(_impl_.hold_p50_us_){0}
+    , decltype(_impl_.hold_p99_us_){0}
+    , decltype(_impl_.hold_max_us_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.lock_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lock_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.site_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.site_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LockProfile::~LockProfile() {
+  // @@protoc_insertion_point(destructor:leader.LockProfile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LockProfile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lock_.Destroy();
+  _impl_.site_.Destroy();
+}
+
+void LockProfile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LockProfile::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.LockProfile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.lock_.ClearToEmpty();
+  _impl_.site_.ClearToEmpty();
+  ::memset(&_impl_.acquisitions_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.hold_max_us_) -
+      reinterpret_cast<char*>(&_impl_.acquisitions_)) + sizeof(_impl_.hold_max_us_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LockProfile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string lock = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_lock();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.LockProfile.lock"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string site = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_site();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.LockProfile.site"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 acquisitions = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.acquisitions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 contended = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.contended_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double wait_total_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.wait_total_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // float wait_p50_us = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.wait_p50_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float wait_p99_us = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.wait_p99_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float wait_max_us = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _impl_.wait_max_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float hold_p50_us = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _impl_.hold_p50_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float hold_p99_us = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _impl_.hold_p99_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float hold_max_us = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _impl_.hold_max_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LockProfile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.LockProfile)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string lock = 1;
+  if (!this->_internal_lock().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_lock().data(), static_cast<int>(this->_internal_lock().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.LockProfile.lock");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_lock(), target);
+  }
+
+  // string site = 2;
+  if (!this->_internal_site().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_site().data(), static_cast<int>(this->_internal_site().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.LockProfile.site");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_site(), target);
+  }
+
+  // int64 acquisitions = 3;
+  if (this->_internal_acquisitions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_acquisitions(), target);
+  }
+
+  // int64 contended = 4;
+  if (this->_internal_contended() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_contended(), target);
+  }
+
+  // double wait_total_ms = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_wait_total_ms = this->_internal_wait_total_ms();
+  uint64_t raw_wait_total_ms;
+  memcpy(&raw_wait_total_ms, &tmp_wait_total_ms, sizeof(tmp_wait_total_ms));
+  if (raw_wait_total_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_wait_total_ms(), target);
+  }
+
+  // float wait_p50_us = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_p50_us = this->_internal_wait_p50_us();
+  uint32_t raw_wait_p50_us;
+  memcpy(&raw_wait_p50_us, &tmp_wait_p50_us, sizeof(tmp_wait_p50_us));
+  if (raw_wait_p50_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_wait_p50_us(), target);
+  }
+
+  // float wait_p99_us = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_p99_us = this->_internal_wait_p99_us();
+  uint32_t raw_wait_p99_us;
+  memcpy(&raw_wait_p99_us, &tmp_wait_p99_us, sizeof(tmp_wait_p99_us));
+  if (raw_wait_p99_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_wait_p99_us(), target);
+  }
+
+  // float wait_max_us = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_max_us = this->_internal_wait_max_us();
+  uint32_t raw_wait_max_us;
+  memcpy(&raw_wait_max_us, &tmp_wait_max_us, sizeof(tmp_wait_max_us));
+  if (raw_wait_max_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_wait_max_us(), target);
+  }
+
+  // float hold_p50_us = 9;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_p50_us = this->_internal_hold_p50_us();
+  uint32_t raw_hold_p50_us;
+  memcpy(&raw_hold_p50_us, &tmp_hold_p50_us, sizeof(tmp_hold_p50_us));
+  if (raw_hold_p50_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_hold_p50_us(), target);
+  }
+
+  // float hold_p99_us = 10;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_p99_us = this->_internal_hold_p99_us();
+  uint32_t raw_hold_p99_us;
+  memcpy(&raw_hold_p99_us, &tmp_hold_p99_us, sizeof(tmp_hold_p99_us));
+  if (raw_hold_p99_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_hold_p99_us(), target);
+  }
+
+  // float hold_max_us = 11;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_max_us = this->_internal_hold_max_us();
+  uint32_t raw_hold_max_us;
+  memcpy(&raw_hold_max_us, &tmp_hold_max_us, sizeof(tmp_hold_max_us));
+  if (raw_hold_max_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_hold_max_us(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.LockProfile)
+  return target;
+}
+
+size_t LockProfile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.LockProfile)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string lock = 1;
+  if (!this->_internal_lock().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_lock());
+  }
+
+  // string site = 2;
+  if (!this->_internal_site().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_site());
+  }
+
+  // int64 acquisitions = 3;
+  if (this->_internal_acquisitions() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_acquisitions());
+  }
+
+  // int64 contended = 4;
+  if (this->_internal_contended() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_contended());
+  }
+
+  // double wait_total_ms = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_wait_total_ms = this->_internal_wait_total_ms();
+  uint64_t raw_wait_total_ms;
+  memcpy(&raw_wait_total_ms, &tmp_wait_total_ms, sizeof(tmp_wait_total_ms));
+  if (raw_wait_total_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // float wait_p50_us = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_p50_us = this->_internal_wait_p50_us();
+  uint32_t raw_wait_p50_us;
+  memcpy(&raw_wait_p50_us, &tmp_wait_p50_us, sizeof(tmp_wait_p50_us));
+  if (raw_wait_p50_us != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float wait_p99_us = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_p99_us = this->_internal_wait_p99_us();
+  uint32_t raw_wait_p99_us;
+  memcpy(&raw_wait_p99_us, &tmp_wait_p99_us, sizeof(tmp_wait_p99_us));
+  if (raw_wait_p99_us != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float wait_max_us = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_max_us = this->_internal_wait_max_us();
+  uint32_t raw_wait_max_us;
+  memcpy(&raw_wait_max_us, &tmp_wait_max_us, sizeof(tmp_wait_max_us));
+  if (raw_wait_max_us != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float hold_p50_us = 9;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_p50_us = this->_internal_hold_p50_us();
+  uint32_t raw_hold_p50_us;
+  memcpy(&raw_hold_p50_us, &tmp_hold_p50_us, sizeof(tmp_hold_p50_us));
+  if (raw_hold_p50_us != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float hold_p99_us = 10;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_p99_us = this->_internal_hold_p99_us();
+  uint32_t raw_hold_p99_us;
+  memcpy(&raw_hold_p99_us, &tmp_hold_p99_us, sizeof(tmp_hold_p99_us));
+  if (raw_hold_p99_us != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float hold_max_us = 11;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_max_us = this->_internal_hold_max_us();
+  uint32_t raw_hold_max_us;
+  memcpy(&raw_hold_max_us, &tmp_hold_max_us, sizeof(tmp_hold_max_us));
+  if (raw_hold_max_us != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LockProfile::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LockProfile::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LockProfile::GetClassData() const { return &_class_data_; }
+
+
+void LockProfile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LockProfile*>(&to_msg);
+  auto& from = static_cast<const LockProfile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.LockProfile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_lock().empty()) {
+    _this->_internal_set_lock(from._internal_lock());
+  }
+  if (!from._internal_site().empty()) {
+    _this->_internal_set_site(from._internal_site());
+  }
+  if (from._internal_acquisitions() != 0) {
+    _this->_internal_set_acquisitions(from._internal_acquisitions());
+  }
+  if (from._internal_contended() != 0) {
+    _this->_internal_set_contended(from._internal_contended());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_wait_total_ms = from._internal_wait_total_ms();
+  uint64_t raw_wait_total_ms;
+  memcpy(&raw_wait_total_ms, &tmp_wait_total_ms, sizeof(tmp_wait_total_ms));
+  if (raw_wait_total_ms != 0) {
+    _this->_internal_set_wait_total_ms(from._internal_wait_total_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_p50_us = from._internal_wait_p50_us();
+  uint32_t raw_wait_p50_us;
+  memcpy(&raw_wait_p50_us, &tmp_wait_p50_us, sizeof(tmp_wait_p50_us));
+  if (raw_wait_p50_us != 0) {
+    _this->_internal_set_wait_p50_us(from._internal_wait_p50_us());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_p99_us = from._internal_wait_p99_us();
+  uint32_t raw_wait_p99_us;
+  memcpy(&raw_wait_p99_us, &tmp_wait_p99_us, sizeof(tmp_wait_p99_us));
+  if (raw_wait_p99_us != 0) {
+    _this->_internal_set_wait_p99_us(from._internal_wait_p99_us());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_wait_max_us = from._internal_wait_max_us();
+  uint32_t raw_wait_max_us;
+  memcpy(&raw_wait_max_us, &tmp_wait_max_us, sizeof(tmp_wait_max_us));
+  if (raw_wait_max_us != 0) {
+    _this->_internal_set_wait_max_us(from._internal_wait_max_us());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_p50_us = from._internal_hold_p50_us();
+  uint32_t raw_hold_p50_us;
+  memcpy(&raw_hold_p50_us, &tmp_hold_p50_us, sizeof(tmp_hold_p50_us));
+  if (raw_hold_p50_us != 0) {
+    _this->_internal_set_hold_p50_us(from._internal_hold_p50_us());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_p99_us = from._internal_hold_p99_us();
+  uint32_t raw_hold_p99_us;
+  memcpy(&raw_hold_p99_us, &tmp_hold_p99_us, sizeof(tmp_hold_p99_us));
+  if (raw_hold_p99_us != 0) {
+    _this->_internal_set_hold_p99_us(from._internal_hold_p99_us());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_hold_max_us = from._internal_hold_max_us();
+  uint32_t raw_hold_max_us;
+  memcpy(&raw_hold_max_us, &tmp_hold_max_us, sizeof(tmp_hold_max_us));
+  if (raw_hold_max_us != 0) {
+    _this->_internal_set_hold_max_us(from._internal_hold_max_us());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LockProfile::CopyFrom(const LockProfile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.LockProfile)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LockProfile::IsInitialized() const {
+  return true;
+}
+
+void LockProfile::InternalSwap(LockProfile* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lock_, lhs_arena,
+      &other->_impl_.lock_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.site_, lhs_arena,
+      &other->_impl_.site_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LockProfile, _impl_.hold_max_us_)
+      + sizeof(LockProfile::_impl_.hold_max_us_)
+      - PROTOBUF_FIELD_OFFSET(LockProfile, _impl_.acquisitions_)>(
+          reinterpret_cast<char*>(&_impl_.acquisitions_),
+          reinterpret_cast<char*>(&other->_impl_.acquisitions_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LockProfile::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[8]);
+}
+
+// ===================================================================
+
+class PhaseLatency::_Internal {
+ public:
+};
+
+PhaseLatency::PhaseLatency(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.PhaseLatency)
+}
+PhaseLatency::PhaseLatency(const PhaseLatency& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PhaseLatency* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.phase_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.mean_ms_){}
+    , decltype(_impl_.p50_ms_){}
+    , decltype(_impl_.p90_ms_){}
+    , decltype(_impl_.p99_ms_){}
+    , decltype(_impl_.p999_ms_){}
+    , decltype(_impl_.max_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.phase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_phase().empty()) {
+    _this->_impl_.phase_.Set(from._internal_phase(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.priority_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.priority_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_priority().empty()) {
+    _this->_impl_.priority_.Set(from._internal_priority(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_ms_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_ms_));
+  // @@protoc_insertion_point(copy_constructor:leader.PhaseLatency)
+}
+
+inline void PhaseLatency::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.phase_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.mean_ms_){0}
+    , decltype(_impl_.p50_ms_){0}
+    , decltype(_impl_.p90_ms_){0}
+    , decltype(_impl_.p99_ms_){0}
+    , decltype(_impl_.p999_ms_){0}
+    , decltype(_impl_.max_ms_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.phase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.priority_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.priority_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PhaseLatency::~PhaseLatency() {
+  // @@protoc_insertion_point(destructor:leader.PhaseLatency)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PhaseLatency::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.phase_.Destroy();
+  _impl_.priority_.Destroy();
+}
+
+void PhaseLatency::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PhaseLatency::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.PhaseLatency)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.phase_.ClearToEmpty();
+  _impl_.priority_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_ms_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_ms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PhaseLatency::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string phase = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_phase();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.PhaseLatency.phase"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string priority = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_priority();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.PhaseLatency.priority"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float mean_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.mean_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float p50_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.p50_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float p90_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.p90_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float p99_ms = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.p99_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float p999_ms = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _impl_.p999_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float max_ms = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _impl_.max_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PhaseLatency::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.PhaseLatency)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string phase = 1;
+  if (!this->_internal_phase().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_phase().data(), static_cast<int>(this->_internal_phase().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.PhaseLatency.phase");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_phase(), target);
+  }
+
+  // string priority = 2;
+  if (!this->_internal_priority().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_priority().data(), static_cast<int>(this->_internal_priority().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.PhaseLatency.priority");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_priority(), target);
+  }
+
+  // uint64 count = 3;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_count(), target);
+  }
+
+  // float mean_ms = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_mean_ms = this->_internal_mean_ms();
+  uint32_t raw_mean_ms;
+  memcpy(&raw_mean_ms, &tmp_mean_ms, sizeof(tmp_mean_ms));
+  if (raw_mean_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_mean_ms(), target);
+  }
+
+  // float p50_ms = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p50_ms = this->_internal_p50_ms();
+  uint32_t raw_p50_ms;
+  memcpy(&raw_p50_ms, &tmp_p50_ms, sizeof(tmp_p50_ms));
+  if (raw_p50_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_p50_ms(), target);
+  }
+
+  // float p90_ms = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p90_ms = this->_internal_p90_ms();
+  uint32_t raw_p90_ms;
+  memcpy(&raw_p90_ms, &tmp_p90_ms, sizeof(tmp_p90_ms));
+  if (raw_p90_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_p90_ms(), target);
+  }
+
+  // float p99_ms = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p99_ms = this->_internal_p99_ms();
+  uint32_t raw_p99_ms;
+  memcpy(&raw_p99_ms, &tmp_p99_ms, sizeof(tmp_p99_ms));
+  if (raw_p99_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_p99_ms(), target);
+  }
+
+  // float p999_ms = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p999_ms = this->_internal_p999_ms();
+  uint32_t raw_p999_ms;
+  memcpy(&raw_p999_ms, &tmp_p999_ms, sizeof(tmp_p999_ms));
+  if (raw_p999_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_p999_ms(), target);
+  }
+
+  // float max_ms = 9;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_ms = this->_internal_max_ms();
+  uint32_t raw_max_ms;
+  memcpy(&raw_max_ms, &tmp_max_ms, sizeof(tmp_max_ms));
+  if (raw_max_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_max_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.PhaseLatency)
+  return target;
+}
+
+size_t PhaseLatency::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.PhaseLatency)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string phase = 1;
+  if (!this->_internal_phase().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_phase());
+  }
+
+  // string priority = 2;
+  if (!this->_internal_priority().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_priority());
+  }
+
+  // uint64 count = 3;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // float mean_ms = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_mean_ms = this->_internal_mean_ms();
+  uint32_t raw_mean_ms;
+  memcpy(&raw_mean_ms, &tmp_mean_ms, sizeof(tmp_mean_ms));
+  if (raw_mean_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float p50_ms = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p50_ms = this->_internal_p50_ms();
+  uint32_t raw_p50_ms;
+  memcpy(&raw_p50_ms, &tmp_p50_ms, sizeof(tmp_p50_ms));
+  if (raw_p50_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float p90_ms = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p90_ms = this->_internal_p90_ms();
+  uint32_t raw_p90_ms;
+  memcpy(&raw_p90_ms, &tmp_p90_ms, sizeof(tmp_p90_ms));
+  if (raw_p90_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float p99_ms = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p99_ms = this->_internal_p99_ms();
+  uint32_t raw_p99_ms;
+  memcpy(&raw_p99_ms, &tmp_p99_ms, sizeof(tmp_p99_ms));
+  if (raw_p99_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float p999_ms = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p999_ms = this->_internal_p999_ms();
+  uint32_t raw_p999_ms;
+  memcpy(&raw_p999_ms, &tmp_p999_ms, sizeof(tmp_p999_ms));
+  if (raw_p999_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float max_ms = 9;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_ms = this->_internal_max_ms();
+  uint32_t raw_max_ms;
+  memcpy(&raw_max_ms, &tmp_max_ms, sizeof(tmp_max_ms));
+  if (raw_max_ms != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PhaseLatency::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PhaseLatency::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PhaseLatency::GetClassData() const { return &_class_data_; }
+
+
+void PhaseLatency::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PhaseLatency*>(&to_msg);
+  auto& from = static_cast<const PhaseLatency&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.PhaseLatency)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_phase().empty()) {
+    _this->_internal_set_phase(from._internal_phase());
+  }
+  if (!from._internal_priority().empty()) {
+    _this->_internal_set_priority(from._internal_priority());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_mean_ms = from._internal_mean_ms();
+  uint32_t raw_mean_ms;
+  memcpy(&raw_mean_ms, &tmp_mean_ms, sizeof(tmp_mean_ms));
+  if (raw_mean_ms != 0) {
+    _this->_internal_set_mean_ms(from._internal_mean_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p50_ms = from._internal_p50_ms();
+  uint32_t raw_p50_ms;
+  memcpy(&raw_p50_ms, &tmp_p50_ms, sizeof(tmp_p50_ms));
+  if (raw_p50_ms != 0) {
+    _this->_internal_set_p50_ms(from._internal_p50_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p90_ms = from._internal_p90_ms();
+  uint32_t raw_p90_ms;
+  memcpy(&raw_p90_ms, &tmp_p90_ms, sizeof(tmp_p90_ms));
+  if (raw_p90_ms != 0) {
+    _this->_internal_set_p90_ms(from._internal_p90_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p99_ms = from._internal_p99_ms();
+  uint32_t raw_p99_ms;
+  memcpy(&raw_p99_ms, &tmp_p99_ms, sizeof(tmp_p99_ms));
+  if (raw_p99_ms != 0) {
+    _this->_internal_set_p99_ms(from._internal_p99_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_p999_ms = from._internal_p999_ms();
+  uint32_t raw_p999_ms;
+  memcpy(&raw_p999_ms, &tmp_p999_ms, sizeof(tmp_p999_ms));
+  if (raw_p999_ms != 0) {
+    _this->_internal_set_p999_ms(from._internal_p999_ms());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_ms = from._internal_max_ms();
+  uint32_t raw_max_ms;
+  memcpy(&raw_max_ms, &tmp_max_ms, sizeof(tmp_max_ms));
+  if (raw_max_ms != 0) {
+    _this->_internal_set_max_ms(from._internal_max_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PhaseLatency::CopyFrom(const PhaseLatency& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.PhaseLatency)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PhaseLatency::IsInitialized() const {
+  return true;
+}
+
+void PhaseLatency::InternalSwap(PhaseLatency* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.phase_, lhs_arena,
+      &other->_impl_.phase_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.priority_, lhs_arena,
+      &other->_impl_.priority_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PhaseLatency, _impl_.max_ms_)
+      + sizeof(PhaseLatency::_impl_.max_ms_)
+      - PROTOBUF_FIELD_OFFSET(PhaseLatency, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PhaseLatency::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[9]);
+}
+
+// ===================================================================
+
+class Metric::_Internal {
+ public:
+};
+
+Metric::Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.Metric)
+}
+Metric::Metric(const Metric& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Metric* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bucket_bounds_){from._impl_.bucket_bounds_}
+    , decltype(_impl_.bucket_counts_){from._impl_.bucket_counts_}
+    , /*decltype(_impl_._bucket_counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.labels_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.sum_){}
+    , decltype(_impl_.count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.labels_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.labels_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_labels().empty()) {
+    _this->_impl_.labels_.Set(from._internal_labels(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_type().empty()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:leader.Metric)
+}
+
+inline void Metric::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bucket_bounds_){arena}
+    , decltype(_impl_.bucket_counts_){arena}
+    , /*decltype(_impl_._bucket_counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.labels_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.value_){0}
+    , decltype(_impl_.sum_){0}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.labels_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.labels_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Metric::~Metric() {
+  // @@protoc_insertion_point(destructor:leader.Metric)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Metric::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bucket_bounds_.~RepeatedField();
+  _impl_.bucket_counts_.~RepeatedField();
+  _impl_.name_.Destroy();
+  _impl_.labels_.Destroy();
+  _impl_.type_.Destroy();
+}
+
+void Metric::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Metric::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.Metric)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bucket_bounds_.Clear();
+  _impl_.bucket_counts_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.labels_.ClearToEmpty();
+  _impl_.type_.ClearToEmpty();
+  ::memset(&_impl_.value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.count_) -
+      reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Metric::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.Metric.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string labels = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_labels();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.Metric.labels"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.Metric.type"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double bucket_bounds = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_bucket_bounds(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 41) {
+          _internal_add_bucket_bounds(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 bucket_counts = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_bucket_counts(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_bucket_counts(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double sum = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.sum_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Metric::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.Metric)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.Metric.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // string labels = 2;
+  if (!this->_internal_labels().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_labels().data(), static_cast<int>(this->_internal_labels().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.Metric.labels");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_labels(), target);
+  }
+
+  // string type = 3;
+  if (!this->_internal_type().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.Metric.type");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_type(), target);
+  }
+
+  // double value = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_value(), target);
+  }
+
+  // repeated double bucket_bounds = 5;
+  if (this->_internal_bucket_bounds_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_bucket_bounds(), target);
+  }
+
+  // repeated uint64 bucket_counts = 6;
+  {
+    int byte_size = _impl_._bucket_counts_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          6, _internal_bucket_counts(), byte_size, target);
+    }
+  }
+
+  // double sum = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sum = this->_internal_sum();
+  uint64_t raw_sum;
+  memcpy(&raw_sum, &tmp_sum, sizeof(tmp_sum));
+  if (raw_sum != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_sum(), target);
+  }
+
+  // uint64 count = 8;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.Metric)
+  return target;
+}
+
+size_t Metric::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.Metric)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated double bucket_bounds = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_bucket_bounds_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated uint64 bucket_counts = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.bucket_counts_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bucket_counts_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string labels = 2;
+  if (!this->_internal_labels().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_labels());
+  }
+
+  // string type = 3;
+  if (!this->_internal_type().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+  }
+
+  // double value = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double sum = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sum = this->_internal_sum();
+  uint64_t raw_sum;
+  memcpy(&raw_sum, &tmp_sum, sizeof(tmp_sum));
+  if (raw_sum != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 count = 8;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Metric::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Metric::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Metric::GetClassData() const { return &_class_data_; }
+
+
+void Metric::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Metric*>(&to_msg);
+  auto& from = static_cast<const Metric&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.Metric)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bucket_bounds_.MergeFrom(from._impl_.bucket_bounds_);
+  _this->_impl_.bucket_counts_.MergeFrom(from._impl_.bucket_counts_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_labels().empty()) {
+    _this->_internal_set_labels(from._internal_labels());
+  }
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = from._internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sum = from._internal_sum();
+  uint64_t raw_sum;
+  memcpy(&raw_sum, &tmp_sum, sizeof(tmp_sum));
+  if (raw_sum != 0) {
+    _this->_internal_set_sum(from._internal_sum());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Metric::CopyFrom(const Metric& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.Metric)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Metric::IsInitialized() const {
+  return true;
+}
+
+void Metric::InternalSwap(Metric* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bucket_bounds_.InternalSwap(&other->_impl_.bucket_bounds_);
+  _impl_.bucket_counts_.InternalSwap(&other->_impl_.bucket_counts_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.labels_, lhs_arena,
+      &other->_impl_.labels_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Metric, _impl_.count_)
+      + sizeof(Metric::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(Metric, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Metric::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[10]);
+}
+
+// ===================================================================
+
+class TraceRequest::_Internal {
+ public:
+};
+
+TraceRequest::TraceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.TraceRequest)
+}
+TraceRequest::TraceRequest(const TraceRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TraceRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.enable_){}
+    , decltype(_impl_.collect_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.enable_, &from._impl_.enable_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.collect_) -
+    reinterpret_cast<char*>(&_impl_.enable_)) + sizeof(_impl_.collect_));
+  // @@protoc_insertion_point(copy_constructor:leader.TraceRequest)
+}
+
+inline void TraceRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.enable_){false}
+    , decltype(_impl_.collect_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TraceRequest::~TraceRequest() {
+  // @@protoc_insertion_point(destructor:leader.TraceRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TraceRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TraceRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TraceRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.TraceRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.enable_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.collect_) -
+      reinterpret_cast<char*>(&_impl_.enable_)) + sizeof(_impl_.collect_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TraceRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool enable = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.enable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool collect = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.collect_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TraceRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.TraceRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool enable = 1;
+  if (this->_internal_enable() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_enable(), target);
+  }
+
+  // bool collect = 2;
+  if (this->_internal_collect() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_collect(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.TraceRequest)
+  return target;
+}
+
+size_t TraceRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.TraceRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool enable = 1;
+  if (this->_internal_enable() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool collect = 2;
+  if (this->_internal_collect() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TraceRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TraceRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TraceRequest::GetClassData() const { return &_class_data_; }
+
+
+void TraceRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TraceRequest*>(&to_msg);
+  auto& from = static_cast<const TraceRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.TraceRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_enable() != 0) {
+    _this->_internal_set_enable(from._internal_enable());
+  }
+  if (from._internal_collect() != 0) {
+    _this->_internal_set_collect(from._internal_collect());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TraceRequest::CopyFrom(const TraceRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.TraceRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TraceRequest::IsInitialized() const {
+  return true;
+}
+
+void TraceRequest::InternalSwap(TraceRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TraceRequest, _impl_.collect_)
+      + sizeof(TraceRequest::_impl_.collect_)
+      - PROTOBUF_FIELD_OFFSET(TraceRequest, _impl_.enable_)>(
+          reinterpret_cast<char*>(&_impl_.enable_),
+          reinterpret_cast<char*>(&other->_impl_.enable_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TraceRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[11]);
+}
+
+// ===================================================================
+
+class TraceReply::_Internal {
+ public:
+};
+
+TraceReply::TraceReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:leader.TraceReply)
+}
+TraceReply::TraceReply(const TraceReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TraceReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_id_){}
+    , decltype(_impl_.events_json_){}
+    , decltype(_impl_.events_){}
+    , decltype(_impl_.dropped_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node_id().empty()) {
+    _this->_impl_.node_id_.Set(from._internal_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.events_json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.events_json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_events_json().empty()) {
+    _this->_impl_.events_json_.Set(from._internal_events_json(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.events_, &from._impl_.events_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dropped_) -
+    reinterpret_cast<char*>(&_impl_.events_)) + sizeof(_impl_.dropped_));
+  // @@protoc_insertion_point(copy_constructor:leader.TraceReply)
+}
+
+inline void TraceReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_id_){}
+    , decltype(_impl_.events_json_){}
+    , decltype(_impl_.events_){int64_t{0}}
+    , decltype(_impl_.dropped_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.events_json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.events_json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TraceReply::~TraceReply() {
+  // @@protoc_insertion_point(destructor:leader.TraceReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TraceReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.node_id_.Destroy();
+  _impl_.events_json_.Destroy();
+}
+
+void TraceReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TraceReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:leader.TraceReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.node_id_.ClearToEmpty();
+  _impl_.events_json_.ClearToEmpty();
+  ::memset(&_impl_.events_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dropped_) -
+      reinterpret_cast<char*>(&_impl_.events_)) + sizeof(_impl_.dropped_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TraceReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string node_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.TraceReply.node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string events_json = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_events_json();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "leader.TraceReply.events_json"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 events = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.events_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 dropped = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TraceReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:leader.TraceReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string node_id = 1;
+  if (!this->_internal_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node_id().data(), static_cast<int>(this->_internal_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.TraceReply.node_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_node_id(), target);
+  }
+
+  // string events_json = 2;
+  if (!this->_internal_events_json().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_events_json().data(), static_cast<int>(this->_internal_events_json().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "leader.TraceReply.events_json");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_events_json(), target);
+  }
+
+  // int64 events = 3;
+  if (this->_internal_events() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_events(), target);
+  }
+
+  // int64 dropped = 4;
+  if (this->_internal_dropped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_dropped(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:leader.TraceReply)
+  return target;
+}
+
+size_t TraceReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:leader.TraceReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string node_id = 1;
+  if (!this->_internal_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node_id());
+  }
+
+  // string events_json = 2;
+  if (!this->_internal_events_json().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_events_json());
+  }
+
+  // int64 events = 3;
+  if (this->_internal_events() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_events());
+  }
+
+  // int64 dropped = 4;
+  if (this->_internal_dropped() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_dropped());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TraceReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TraceReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TraceReply::GetClassData() const { return &_class_data_; }
+
+
+void TraceReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TraceReply*>(&to_msg);
+  auto& from = static_cast<const TraceReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:leader.TraceReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_node_id().empty()) {
+    _this->_internal_set_node_id(from._internal_node_id());
+  }
+  if (!from._internal_events_json().empty()) {
+    _this->_internal_set_events_json(from._internal_events_json());
+  }
+  if (from._internal_events() != 0) {
+    _this->_internal_set_events(from._internal_events());
+  }
+  if (from._internal_dropped() != 0) {
+    _this->_internal_set_dropped(from._internal_dropped());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TraceReply::CopyFrom(const TraceReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:leader.TraceReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TraceReply::IsInitialized() const {
+  return true;
+}
+
+void TraceReply::InternalSwap(TraceReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_id_, lhs_arena,
+      &other->_impl_.node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.events_json_, lhs_arena,
+      &other->_impl_.events_json_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TraceReply, _impl_.dropped_)
+      + sizeof(TraceReply::_impl_.dropped_)
+      - PROTOBUF_FIELD_OFFSET(TraceReply, _impl_.events_)>(
+          reinterpret_cast<char*>(&_impl_.events_),
+          reinterpret_cast<char*>(&other->_impl_.events_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TraceReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_leader_2eproto_getter, &descriptor_table_leader_2eproto_once,
+      file_level_metadata_leader_2eproto[12]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace leader
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::leader::NodeStatus*
+Arena::CreateMaybeMessage< ::leader::NodeStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::NodeStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::Task*
+Arena::CreateMaybeMessage< ::leader::Task >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::Task >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::StealRequest*
+Arena::CreateMaybeMessage< ::leader::StealRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::StealRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::StealReply*
+Arena::CreateMaybeMessage< ::leader::StealReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::StealReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::TaskBatch*
+Arena::CreateMaybeMessage< ::leader::TaskBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::TaskBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::Ack*
+Arena::CreateMaybeMessage< ::leader::Ack >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::Ack >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::StatsRequest*
+Arena::CreateMaybeMessage< ::leader::StatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::StatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::NodeStats*
+Arena::CreateMaybeMessage< ::leader::NodeStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::NodeStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::LockProfile*
+Arena::CreateMaybeMessage< ::leader::LockProfile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::LockProfile >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::PhaseLatency*
+Arena::CreateMaybeMessage< ::leader::PhaseLatency >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::PhaseLatency >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::Metric*
+Arena::CreateMaybeMessage< ::leader::Metric >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::Metric >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::TraceRequest*
+Arena::CreateMaybeMessage< ::leader::TraceRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::TraceRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::leader::TraceReply*
+Arena::CreateMaybeMessage< ::leader::TraceReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::leader::TraceReply >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
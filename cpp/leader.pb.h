@@ -23,6 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -48,17 +49,57 @@ namespace leader {
 class Ack;
 struct AckDefaultTypeInternal;
 extern AckDefaultTypeInternal _Ack_default_instance_;
+class LockProfile;
+struct LockProfileDefaultTypeInternal;
+extern LockProfileDefaultTypeInternal _LockProfile_default_instance_;
+class Metric;
+struct MetricDefaultTypeInternal;
+extern MetricDefaultTypeInternal _Metric_default_instance_;
+class NodeStats;
+struct NodeStatsDefaultTypeInternal;
+extern NodeStatsDefaultTypeInternal _NodeStats_default_instance_;
 class NodeStatus;
 struct NodeStatusDefaultTypeInternal;
 extern NodeStatusDefaultTypeInternal _NodeStatus_default_instance_;
+class PhaseLatency;
+struct PhaseLatencyDefaultTypeInternal;
+extern PhaseLatencyDefaultTypeInternal _PhaseLatency_default_instance_;
+class StatsRequest;
+struct StatsRequestDefaultTypeInternal;
+extern StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+class StealReply;
+struct StealReplyDefaultTypeInternal;
+extern StealReplyDefaultTypeInternal _StealReply_default_instance_;
+class StealRequest;
+struct StealRequestDefaultTypeInternal;
+extern StealRequestDefaultTypeInternal _StealRequest_default_instance_;
 class Task;
 struct TaskDefaultTypeInternal;
 extern TaskDefaultTypeInternal _Task_default_instance_;
+class TaskBatch;
+struct TaskBatchDefaultTypeInternal;
+extern TaskBatchDefaultTypeInternal _TaskBatch_default_instance_;
+class TraceReply;
+struct TraceReplyDefaultTypeInternal;
+extern TraceReplyDefaultTypeInternal _TraceReply_default_instance_;
+class TraceRequest;
+struct TraceRequestDefaultTypeInternal;
+extern TraceRequestDefaultTypeInternal _TraceRequest_default_instance_;
 }  // namespace leader
 PROTOBUF_NAMESPACE_OPEN
 template<> ::leader::Ack* Arena::CreateMaybeMessage<::leader::Ack>(Arena*);
+template<> ::leader::LockProfile* Arena::CreateMaybeMessage<::leader::LockProfile>(Arena*);
+template<> ::leader::Metric* Arena::CreateMaybeMessage<::leader::Metric>(Arena*);
+template<> ::leader::NodeStats* Arena::CreateMaybeMessage<::leader::NodeStats>(Arena*);
 template<> ::leader::NodeStatus* Arena::CreateMaybeMessage<::leader::NodeStatus>(Arena*);
+template<> ::leader::PhaseLatency* Arena::CreateMaybeMessage<::leader::PhaseLatency>(Arena*);
+template<> ::leader::StatsRequest* Arena::CreateMaybeMessage<::leader::StatsRequest>(Arena*);
+template<> ::leader::StealReply* Arena::CreateMaybeMessage<::leader::StealReply>(Arena*);
+template<> ::leader::StealRequest* Arena::CreateMaybeMessage<::leader::StealRequest>(Arena*);
 template<> ::leader::Task* Arena::CreateMaybeMessage<::leader::Task>(Arena*);
+template<> ::leader::TaskBatch* Arena::CreateMaybeMessage<::leader::TaskBatch>(Arena*);
+template<> ::leader::TraceReply* Arena::CreateMaybeMessage<::leader::TraceReply>(Arena*);
+template<> ::leader::TraceRequest* Arena::CreateMaybeMessage<::leader::TraceRequest>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace leader {
 
@@ -188,6 +229,12 @@ class NodeStatus final :
     kNodeIdFieldNumber = 1,
     kScoreFieldNumber = 2,
     kQueueLengthFieldNumber = 3,
+    kExpectedWaitMsFieldNumber = 4,
+    kDrainMsFieldNumber = 5,
+    kBacklogMsFieldNumber = 6,
+    kCapacityFieldNumber = 7,
+    kServiceRateFieldNumber = 8,
+    kServiceP99MsFieldNumber = 9,
   };
   // string node_id = 1;
   void clear_node_id();
@@ -221,6 +268,60 @@ class NodeStatus final :
   void _internal_set_queue_length(int32_t value);
   public:
 
+  // float expected_wait_ms = 4;
+  void clear_expected_wait_ms();
+  float expected_wait_ms() const;
+  void set_expected_wait_ms(float value);
+  private:
+  float _internal_expected_wait_ms() const;
+  void _internal_set_expected_wait_ms(float value);
+  public:
+
+  // float drain_ms = 5;
+  void clear_drain_ms();
+  float drain_ms() const;
+  void set_drain_ms(float value);
+  private:
+  float _internal_drain_ms() const;
+  void _internal_set_drain_ms(float value);
+  public:
+
+  // int64 backlog_ms = 6;
+  void clear_backlog_ms();
+  int64_t backlog_ms() const;
+  void set_backlog_ms(int64_t value);
+  private:
+  int64_t _internal_backlog_ms() const;
+  void _internal_set_backlog_ms(int64_t value);
+  public:
+
+  // float capacity = 7;
+  void clear_capacity();
+  float capacity() const;
+  void set_capacity(float value);
+  private:
+  float _internal_capacity() const;
+  void _internal_set_capacity(float value);
+  public:
+
+  // float service_rate = 8;
+  void clear_service_rate();
+  float service_rate() const;
+  void set_service_rate(float value);
+  private:
+  float _internal_service_rate() const;
+  void _internal_set_service_rate(float value);
+  public:
+
+  // float service_p99_ms = 9;
+  void clear_service_p99_ms();
+  float service_p99_ms() const;
+  void set_service_p99_ms(float value);
+  private:
+  float _internal_service_p99_ms() const;
+  void _internal_set_service_p99_ms(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:leader.NodeStatus)
  private:
   class _Internal;
@@ -232,6 +333,12 @@ class NodeStatus final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_id_;
     float score_;
     int32_t queue_length_;
+    float expected_wait_ms_;
+    float drain_ms_;
+    int64_t backlog_ms_;
+    float capacity_;
+    float service_rate_;
+    float service_p99_ms_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -360,9 +467,43 @@ class Task final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kRoutingKeyFieldNumber = 4,
+    kTenantFieldNumber = 8,
     kTaskIdFieldNumber = 1,
     kDurationMsFieldNumber = 2,
+    kForwardedFieldNumber = 3,
+    kPriorityFieldNumber = 5,
+    kReceivedUsFieldNumber = 6,
+    kTraceIdFieldNumber = 7,
   };
+  // string routing_key = 4;
+  void clear_routing_key();
+  const std::string& routing_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_routing_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_routing_key();
+  PROTOBUF_NODISCARD std::string* release_routing_key();
+  void set_allocated_routing_key(std::string* routing_key);
+  private:
+  const std::string& _internal_routing_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_routing_key(const std::string& value);
+  std::string* _internal_mutable_routing_key();
+  public:
+
+  // string tenant = 8;
+  void clear_tenant();
+  const std::string& tenant() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tenant(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tenant();
+  PROTOBUF_NODISCARD std::string* release_tenant();
+  void set_allocated_tenant(std::string* tenant);
+  private:
+  const std::string& _internal_tenant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tenant(const std::string& value);
+  std::string* _internal_mutable_tenant();
+  public:
+
   // int32 task_id = 1;
   void clear_task_id();
   int32_t task_id() const;
@@ -381,6 +522,42 @@ class Task final :
   void _internal_set_duration_ms(int32_t value);
   public:
 
+  // bool forwarded = 3;
+  void clear_forwarded();
+  bool forwarded() const;
+  void set_forwarded(bool value);
+  private:
+  bool _internal_forwarded() const;
+  void _internal_set_forwarded(bool value);
+  public:
+
+  // int32 priority = 5;
+  void clear_priority();
+  int32_t priority() const;
+  void set_priority(int32_t value);
+  private:
+  int32_t _internal_priority() const;
+  void _internal_set_priority(int32_t value);
+  public:
+
+  // int64 received_us = 6;
+  void clear_received_us();
+  int64_t received_us() const;
+  void set_received_us(int64_t value);
+  private:
+  int64_t _internal_received_us() const;
+  void _internal_set_received_us(int64_t value);
+  public:
+
+  // uint64 trace_id = 7;
+  void clear_trace_id();
+  uint64_t trace_id() const;
+  void set_trace_id(uint64_t value);
+  private:
+  uint64_t _internal_trace_id() const;
+  void _internal_set_trace_id(uint64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:leader.Task)
  private:
   class _Internal;
@@ -389,8 +566,14 @@ class Task final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr routing_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tenant_;
     int32_t task_id_;
     int32_t duration_ms_;
+    bool forwarded_;
+    int32_t priority_;
+    int64_t received_us_;
+    uint64_t trace_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -398,24 +581,24 @@ class Task final :
 };
 // -------------------------------------------------------------------
 
-class Ack final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.Ack) */ {
+class StealRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.StealRequest) */ {
  public:
-  inline Ack() : Ack(nullptr) {}
-  ~Ack() override;
-  explicit PROTOBUF_CONSTEXPR Ack(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline StealRequest() : StealRequest(nullptr) {}
+  ~StealRequest() override;
+  explicit PROTOBUF_CONSTEXPR StealRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Ack(const Ack& from);
-  Ack(Ack&& from) noexcept
-    : Ack() {
+  StealRequest(const StealRequest& from);
+  StealRequest(StealRequest&& from) noexcept
+    : StealRequest() {
     *this = ::std::move(from);
   }
 
-  inline Ack& operator=(const Ack& from) {
+  inline StealRequest& operator=(const StealRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Ack& operator=(Ack&& from) noexcept {
+  inline StealRequest& operator=(StealRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -438,20 +621,20 @@ class Ack final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Ack& default_instance() {
+  static const StealRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Ack* internal_default_instance() {
-    return reinterpret_cast<const Ack*>(
-               &_Ack_default_instance_);
+  static inline const StealRequest* internal_default_instance() {
+    return reinterpret_cast<const StealRequest*>(
+               &_StealRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     2;
 
-  friend void swap(Ack& a, Ack& b) {
+  friend void swap(StealRequest& a, StealRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(Ack* other) {
+  inline void Swap(StealRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -464,7 +647,7 @@ class Ack final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Ack* other) {
+  void UnsafeArenaSwap(StealRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -472,14 +655,14 @@ class Ack final :
 
   // implements Message ----------------------------------------------
 
-  Ack* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Ack>(arena);
+  StealRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StealRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Ack& from);
+  void CopyFrom(const StealRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Ack& from) {
-    Ack::MergeImpl(*this, from);
+  void MergeFrom( const StealRequest& from) {
+    StealRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -497,15 +680,15 @@ class Ack final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Ack* other);
+  void InternalSwap(StealRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "leader.Ack";
+    return "leader.StealRequest";
   }
   protected:
-  explicit Ack(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit StealRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -519,23 +702,33 @@ class Ack final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 1,
+    kNodeIdFieldNumber = 1,
+    kMaxTasksFieldNumber = 2,
   };
-  // string message = 1;
-  void clear_message();
-  const std::string& message() const;
+  // string node_id = 1;
+  void clear_node_id();
+  const std::string& node_id() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message();
-  PROTOBUF_NODISCARD std::string* release_message();
-  void set_allocated_message(std::string* message);
+  void set_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_id();
+  PROTOBUF_NODISCARD std::string* release_node_id();
+  void set_allocated_node_id(std::string* node_id);
   private:
-  const std::string& _internal_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
-  std::string* _internal_mutable_message();
+  const std::string& _internal_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_id(const std::string& value);
+  std::string* _internal_mutable_node_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:leader.Ack)
+  // int32 max_tasks = 2;
+  void clear_max_tasks();
+  int32_t max_tasks() const;
+  void set_max_tasks(int32_t value);
+  private:
+  int32_t _internal_max_tasks() const;
+  void _internal_set_max_tasks(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.StealRequest)
  private:
   class _Internal;
 
@@ -543,209 +736,4212 @@ class Ack final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_id_;
+    int32_t max_tasks_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_leader_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class StealReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.StealReply) */ {
+ public:
+  inline StealReply() : StealReply(nullptr) {}
+  ~StealReply() override;
+  explicit PROTOBUF_CONSTEXPR StealReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  StealReply(const StealReply& from);
+  StealReply(StealReply&& from) noexcept
+    : StealReply() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// NodeStatus
+  inline StealReply& operator=(const StealReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StealReply& operator=(StealReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string node_id = 1;
-inline void NodeStatus::clear_node_id() {
-  _impl_.node_id_.ClearToEmpty();
-}
-inline const std::string& NodeStatus::node_id() const {
-  // @@protoc_insertion_point(field_get:leader.NodeStatus.node_id)
-  return _internal_node_id();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void NodeStatus::set_node_id(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:leader.NodeStatus.node_id)
-}
-inline std::string* NodeStatus::mutable_node_id() {
-  std::string* _s = _internal_mutable_node_id();
-  // @@protoc_insertion_point(field_mutable:leader.NodeStatus.node_id)
-  return _s;
-}
-inline const std::string& NodeStatus::_internal_node_id() const {
-  return _impl_.node_id_.Get();
-}
-inline void NodeStatus::_internal_set_node_id(const std::string& value) {
-  
-  _impl_.node_id_.Set(value, GetArenaForAllocation());
-}
-inline std::string* NodeStatus::_internal_mutable_node_id() {
-  
-  return _impl_.node_id_.Mutable(GetArenaForAllocation());
-}
-inline std::string* NodeStatus::release_node_id() {
-  // @@protoc_insertion_point(field_release:leader.NodeStatus.node_id)
-  return _impl_.node_id_.Release();
-}
-inline void NodeStatus::set_allocated_node_id(std::string* node_id) {
-  if (node_id != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  _impl_.node_id_.SetAllocated(node_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.node_id_.IsDefault()) {
-    _impl_.node_id_.Set("", GetArenaForAllocation());
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:leader.NodeStatus.node_id)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StealReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StealReply* internal_default_instance() {
+    return reinterpret_cast<const StealReply*>(
+               &_StealReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-// float score = 2;
-inline void NodeStatus::clear_score() {
-  _impl_.score_ = 0;
-}
-inline float NodeStatus::_internal_score() const {
-  return _impl_.score_;
-}
-inline float NodeStatus::score() const {
-  // @@protoc_insertion_point(field_get:leader.NodeStatus.score)
-  return _internal_score();
-}
-inline void NodeStatus::_internal_set_score(float value) {
-  
-  _impl_.score_ = value;
-}
-inline void NodeStatus::set_score(float value) {
-  _internal_set_score(value);
-  // @@protoc_insertion_point(field_set:leader.NodeStatus.score)
-}
+  friend void swap(StealReply& a, StealReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StealReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StealReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// int32 queue_length = 3;
-inline void NodeStatus::clear_queue_length() {
-  _impl_.queue_length_ = 0;
-}
-inline int32_t NodeStatus::_internal_queue_length() const {
-  return _impl_.queue_length_;
-}
-inline int32_t NodeStatus::queue_length() const {
-  // @@protoc_insertion_point(field_get:leader.NodeStatus.queue_length)
-  return _internal_queue_length();
-}
-inline void NodeStatus::_internal_set_queue_length(int32_t value) {
-  
-  _impl_.queue_length_ = value;
-}
-inline void NodeStatus::set_queue_length(int32_t value) {
-  _internal_set_queue_length(value);
-  // @@protoc_insertion_point(field_set:leader.NodeStatus.queue_length)
-}
+  // implements Message ----------------------------------------------
 
-// -------------------------------------------------------------------
+  StealReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StealReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StealReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StealReply& from) {
+    StealReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// Task
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// int32 task_id = 1;
-inline void Task::clear_task_id() {
-  _impl_.task_id_ = 0;
-}
-inline int32_t Task::_internal_task_id() const {
-  return _impl_.task_id_;
-}
-inline int32_t Task::task_id() const {
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StealReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.StealReply";
+  }
+  protected:
+  explicit StealReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTasksFieldNumber = 1,
+  };
+  // int32 tasks = 1;
+  void clear_tasks();
+  int32_t tasks() const;
+  void set_tasks(int32_t value);
+  private:
+  int32_t _internal_tasks() const;
+  void _internal_set_tasks(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.StealReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t tasks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TaskBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.TaskBatch) */ {
+ public:
+  inline TaskBatch() : TaskBatch(nullptr) {}
+  ~TaskBatch() override;
+  explicit PROTOBUF_CONSTEXPR TaskBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TaskBatch(const TaskBatch& from);
+  TaskBatch(TaskBatch&& from) noexcept
+    : TaskBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline TaskBatch& operator=(const TaskBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TaskBatch& operator=(TaskBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TaskBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TaskBatch* internal_default_instance() {
+    return reinterpret_cast<const TaskBatch*>(
+               &_TaskBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(TaskBatch& a, TaskBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TaskBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TaskBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TaskBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TaskBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TaskBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TaskBatch& from) {
+    TaskBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TaskBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.TaskBatch";
+  }
+  protected:
+  explicit TaskBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTasksFieldNumber = 1,
+  };
+  // repeated .leader.Task tasks = 1;
+  int tasks_size() const;
+  private:
+  int _internal_tasks_size() const;
+  public:
+  void clear_tasks();
+  ::leader::Task* mutable_tasks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Task >*
+      mutable_tasks();
+  private:
+  const ::leader::Task& _internal_tasks(int index) const;
+  ::leader::Task* _internal_add_tasks();
+  public:
+  const ::leader::Task& tasks(int index) const;
+  ::leader::Task* add_tasks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Task >&
+      tasks() const;
+
+  // @@protoc_insertion_point(class_scope:leader.TaskBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Task > tasks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Ack final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.Ack) */ {
+ public:
+  inline Ack() : Ack(nullptr) {}
+  ~Ack() override;
+  explicit PROTOBUF_CONSTEXPR Ack(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Ack(const Ack& from);
+  Ack(Ack&& from) noexcept
+    : Ack() {
+    *this = ::std::move(from);
+  }
+
+  inline Ack& operator=(const Ack& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Ack& operator=(Ack&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Ack& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Ack* internal_default_instance() {
+    return reinterpret_cast<const Ack*>(
+               &_Ack_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Ack& a, Ack& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Ack* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Ack* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Ack* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Ack>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Ack& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Ack& from) {
+    Ack::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Ack* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.Ack";
+  }
+  protected:
+  explicit Ack(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+  };
+  // string message = 1;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.Ack)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:leader.StatsRequest) */ {
+ public:
+  inline StatsRequest() : StatsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR StatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsRequest(const StatsRequest& from);
+  StatsRequest(StatsRequest&& from) noexcept
+    : StatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsRequest& operator=(const StatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsRequest& operator=(StatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatsRequest*>(
+               &_StatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(StatsRequest& a, StatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.StatsRequest";
+  }
+  protected:
+  explicit StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:leader.StatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NodeStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.NodeStats) */ {
+ public:
+  inline NodeStats() : NodeStats(nullptr) {}
+  ~NodeStats() override;
+  explicit PROTOBUF_CONSTEXPR NodeStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NodeStats(const NodeStats& from);
+  NodeStats(NodeStats&& from) noexcept
+    : NodeStats() {
+    *this = ::std::move(from);
+  }
+
+  inline NodeStats& operator=(const NodeStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NodeStats& operator=(NodeStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NodeStats* internal_default_instance() {
+    return reinterpret_cast<const NodeStats*>(
+               &_NodeStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(NodeStats& a, NodeStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NodeStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NodeStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NodeStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeStats& from) {
+    NodeStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NodeStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.NodeStats";
+  }
+  protected:
+  explicit NodeStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMetricsFieldNumber = 15,
+    kLatencyFieldNumber = 16,
+    kLocksFieldNumber = 17,
+    kNodeIdFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kBacklogMsFieldNumber = 4,
+    kQueueLengthFieldNumber = 3,
+    kCapacityFieldNumber = 5,
+    kTasksCompletedFieldNumber = 6,
+    kArrivalRateFieldNumber = 7,
+    kServiceRateFieldNumber = 8,
+    kServiceMeanMsFieldNumber = 9,
+    kServiceP50MsFieldNumber = 10,
+    kServiceP90MsFieldNumber = 11,
+    kServiceP99MsFieldNumber = 12,
+    kExpectedWaitMsFieldNumber = 13,
+    kDrainMsFieldNumber = 14,
+  };
+  // repeated .leader.Metric metrics = 15;
+  int metrics_size() const;
+  private:
+  int _internal_metrics_size() const;
+  public:
+  void clear_metrics();
+  ::leader::Metric* mutable_metrics(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Metric >*
+      mutable_metrics();
+  private:
+  const ::leader::Metric& _internal_metrics(int index) const;
+  ::leader::Metric* _internal_add_metrics();
+  public:
+  const ::leader::Metric& metrics(int index) const;
+  ::leader::Metric* add_metrics();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Metric >&
+      metrics() const;
+
+  // repeated .leader.PhaseLatency latency = 16;
+  int latency_size() const;
+  private:
+  int _internal_latency_size() const;
+  public:
+  void clear_latency();
+  ::leader::PhaseLatency* mutable_latency(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::PhaseLatency >*
+      mutable_latency();
+  private:
+  const ::leader::PhaseLatency& _internal_latency(int index) const;
+  ::leader::PhaseLatency* _internal_add_latency();
+  public:
+  const ::leader::PhaseLatency& latency(int index) const;
+  ::leader::PhaseLatency* add_latency();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::PhaseLatency >&
+      latency() const;
+
+  // repeated .leader.LockProfile locks = 17;
+  int locks_size() const;
+  private:
+  int _internal_locks_size() const;
+  public:
+  void clear_locks();
+  ::leader::LockProfile* mutable_locks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::LockProfile >*
+      mutable_locks();
+  private:
+  const ::leader::LockProfile& _internal_locks(int index) const;
+  ::leader::LockProfile* _internal_add_locks();
+  public:
+  const ::leader::LockProfile& locks(int index) const;
+  ::leader::LockProfile* add_locks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::LockProfile >&
+      locks() const;
+
+  // string node_id = 1;
+  void clear_node_id();
+  const std::string& node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_id();
+  PROTOBUF_NODISCARD std::string* release_node_id();
+  void set_allocated_node_id(std::string* node_id);
+  private:
+  const std::string& _internal_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_id(const std::string& value);
+  std::string* _internal_mutable_node_id();
+  public:
+
+  // string leader_id = 2;
+  void clear_leader_id();
+  const std::string& leader_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_id();
+  PROTOBUF_NODISCARD std::string* release_leader_id();
+  void set_allocated_leader_id(std::string* leader_id);
+  private:
+  const std::string& _internal_leader_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_id(const std::string& value);
+  std::string* _internal_mutable_leader_id();
+  public:
+
+  // int64 backlog_ms = 4;
+  void clear_backlog_ms();
+  int64_t backlog_ms() const;
+  void set_backlog_ms(int64_t value);
+  private:
+  int64_t _internal_backlog_ms() const;
+  void _internal_set_backlog_ms(int64_t value);
+  public:
+
+  // int32 queue_length = 3;
+  void clear_queue_length();
+  int32_t queue_length() const;
+  void set_queue_length(int32_t value);
+  private:
+  int32_t _internal_queue_length() const;
+  void _internal_set_queue_length(int32_t value);
+  public:
+
+  // float capacity = 5;
+  void clear_capacity();
+  float capacity() const;
+  void set_capacity(float value);
+  private:
+  float _internal_capacity() const;
+  void _internal_set_capacity(float value);
+  public:
+
+  // int64 tasks_completed = 6;
+  void clear_tasks_completed();
+  int64_t tasks_completed() const;
+  void set_tasks_completed(int64_t value);
+  private:
+  int64_t _internal_tasks_completed() const;
+  void _internal_set_tasks_completed(int64_t value);
+  public:
+
+  // float arrival_rate = 7;
+  void clear_arrival_rate();
+  float arrival_rate() const;
+  void set_arrival_rate(float value);
+  private:
+  float _internal_arrival_rate() const;
+  void _internal_set_arrival_rate(float value);
+  public:
+
+  // float service_rate = 8;
+  void clear_service_rate();
+  float service_rate() const;
+  void set_service_rate(float value);
+  private:
+  float _internal_service_rate() const;
+  void _internal_set_service_rate(float value);
+  public:
+
+  // float service_mean_ms = 9;
+  void clear_service_mean_ms();
+  float service_mean_ms() const;
+  void set_service_mean_ms(float value);
+  private:
+  float _internal_service_mean_ms() const;
+  void _internal_set_service_mean_ms(float value);
+  public:
+
+  // float service_p50_ms = 10;
+  void clear_service_p50_ms();
+  float service_p50_ms() const;
+  void set_service_p50_ms(float value);
+  private:
+  float _internal_service_p50_ms() const;
+  void _internal_set_service_p50_ms(float value);
+  public:
+
+  // float service_p90_ms = 11;
+  void clear_service_p90_ms();
+  float service_p90_ms() const;
+  void set_service_p90_ms(float value);
+  private:
+  float _internal_service_p90_ms() const;
+  void _internal_set_service_p90_ms(float value);
+  public:
+
+  // float service_p99_ms = 12;
+  void clear_service_p99_ms();
+  float service_p99_ms() const;
+  void set_service_p99_ms(float value);
+  private:
+  float _internal_service_p99_ms() const;
+  void _internal_set_service_p99_ms(float value);
+  public:
+
+  // float expected_wait_ms = 13;
+  void clear_expected_wait_ms();
+  float expected_wait_ms() const;
+  void set_expected_wait_ms(float value);
+  private:
+  float _internal_expected_wait_ms() const;
+  void _internal_set_expected_wait_ms(float value);
+  public:
+
+  // float drain_ms = 14;
+  void clear_drain_ms();
+  float drain_ms() const;
+  void set_drain_ms(float value);
+  private:
+  float _internal_drain_ms() const;
+  void _internal_set_drain_ms(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.NodeStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Metric > metrics_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::PhaseLatency > latency_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::LockProfile > locks_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_id_;
+    int64_t backlog_ms_;
+    int32_t queue_length_;
+    float capacity_;
+    int64_t tasks_completed_;
+    float arrival_rate_;
+    float service_rate_;
+    float service_mean_ms_;
+    float service_p50_ms_;
+    float service_p90_ms_;
+    float service_p99_ms_;
+    float expected_wait_ms_;
+    float drain_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LockProfile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.LockProfile) */ {
+ public:
+  inline LockProfile() : LockProfile(nullptr) {}
+  ~LockProfile() override;
+  explicit PROTOBUF_CONSTEXPR LockProfile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LockProfile(const LockProfile& from);
+  LockProfile(LockProfile&& from) noexcept
+    : LockProfile() {
+    *this = ::std::move(from);
+  }
+
+  inline LockProfile& operator=(const LockProfile& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LockProfile& operator=(LockProfile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockProfile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockProfile* internal_default_instance() {
+    return reinterpret_cast<const LockProfile*>(
+               &_LockProfile_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(LockProfile& a, LockProfile& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockProfile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockProfile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LockProfile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockProfile>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockProfile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockProfile& from) {
+    LockProfile::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockProfile* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.LockProfile";
+  }
+  protected:
+  explicit LockProfile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLockFieldNumber = 1,
+    kSiteFieldNumber = 2,
+    kAcquisitionsFieldNumber = 3,
+    kContendedFieldNumber = 4,
+    kWaitTotalMsFieldNumber = 5,
+    kWaitP50UsFieldNumber = 6,
+    kWaitP99UsFieldNumber = 7,
+    kWaitMaxUsFieldNumber = 8,
+    kHoldP50UsFieldNumber = 9,
+    kHoldP99UsFieldNumber = 10,
+    kHoldMaxUsFieldNumber = 11,
+  };
+  // string lock = 1;
+  void clear_lock();
+  const std::string& lock() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_lock(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_lock();
+  PROTOBUF_NODISCARD std::string* release_lock();
+  void set_allocated_lock(std::string* lock);
+  private:
+  const std::string& _internal_lock() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lock(const std::string& value);
+  std::string* _internal_mutable_lock();
+  public:
+
+  // string site = 2;
+  void clear_site();
+  const std::string& site() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_site(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_site();
+  PROTOBUF_NODISCARD std::string* release_site();
+  void set_allocated_site(std::string* site);
+  private:
+  const std::string& _internal_site() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_site(const std::string& value);
+  std::string* _internal_mutable_site();
+  public:
+
+  // int64 acquisitions = 3;
+  void clear_acquisitions();
+  int64_t acquisitions() const;
+  void set_acquisitions(int64_t value);
+  private:
+  int64_t _internal_acquisitions() const;
+  void _internal_set_acquisitions(int64_t value);
+  public:
+
+  // int64 contended = 4;
+  void clear_contended();
+  int64_t contended() const;
+  void set_contended(int64_t value);
+  private:
+  int64_t _internal_contended() const;
+  void _internal_set_contended(int64_t value);
+  public:
+
+  // double wait_total_ms = 5;
+  void clear_wait_total_ms();
+  double wait_total_ms() const;
+  void set_wait_total_ms(double value);
+  private:
+  double _internal_wait_total_ms() const;
+  void _internal_set_wait_total_ms(double value);
+  public:
+
+  // float wait_p50_us = 6;
+  void clear_wait_p50_us();
+  float wait_p50_us() const;
+  void set_wait_p50_us(float value);
+  private:
+  float _internal_wait_p50_us() const;
+  void _internal_set_wait_p50_us(float value);
+  public:
+
+  // float wait_p99_us = 7;
+  void clear_wait_p99_us();
+  float wait_p99_us() const;
+  void set_wait_p99_us(float value);
+  private:
+  float _internal_wait_p99_us() const;
+  void _internal_set_wait_p99_us(float value);
+  public:
+
+  // float wait_max_us = 8;
+  void clear_wait_max_us();
+  float wait_max_us() const;
+  void set_wait_max_us(float value);
+  private:
+  float _internal_wait_max_us() const;
+  void _internal_set_wait_max_us(float value);
+  public:
+
+  // float hold_p50_us = 9;
+  void clear_hold_p50_us();
+  float hold_p50_us() const;
+  void set_hold_p50_us(float value);
+  private:
+  float _internal_hold_p50_us() const;
+  void _internal_set_hold_p50_us(float value);
+  public:
+
+  // float hold_p99_us = 10;
+  void clear_hold_p99_us();
+  float hold_p99_us() const;
+  void set_hold_p99_us(float value);
+  private:
+  float _internal_hold_p99_us() const;
+  void _internal_set_hold_p99_us(float value);
+  public:
+
+  // float hold_max_us = 11;
+  void clear_hold_max_us();
+  float hold_max_us() const;
+  void set_hold_max_us(float value);
+  private:
+  float _internal_hold_max_us() const;
+  void _internal_set_hold_max_us(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.LockProfile)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lock_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr site_;
+    int64_t acquisitions_;
+    int64_t contended_;
+    double wait_total_ms_;
+    float wait_p50_us_;
+    float wait_p99_us_;
+    float wait_max_us_;
+    float hold_p50_us_;
+    float hold_p99_us_;
+    float hold_max_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PhaseLatency final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.PhaseLatency) */ {
+ public:
+  inline PhaseLatency() : PhaseLatency(nullptr) {}
+  ~PhaseLatency() override;
+  explicit PROTOBUF_CONSTEXPR PhaseLatency(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PhaseLatency(const PhaseLatency& from);
+  PhaseLatency(PhaseLatency&& from) noexcept
+    : PhaseLatency() {
+    *this = ::std::move(from);
+  }
+
+  inline PhaseLatency& operator=(const PhaseLatency& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PhaseLatency& operator=(PhaseLatency&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PhaseLatency& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PhaseLatency* internal_default_instance() {
+    return reinterpret_cast<const PhaseLatency*>(
+               &_PhaseLatency_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PhaseLatency& a, PhaseLatency& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PhaseLatency* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PhaseLatency* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PhaseLatency* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PhaseLatency>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PhaseLatency& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PhaseLatency& from) {
+    PhaseLatency::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PhaseLatency* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.PhaseLatency";
+  }
+  protected:
+  explicit PhaseLatency(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPhaseFieldNumber = 1,
+    kPriorityFieldNumber = 2,
+    kCountFieldNumber = 3,
+    kMeanMsFieldNumber = 4,
+    kP50MsFieldNumber = 5,
+    kP90MsFieldNumber = 6,
+    kP99MsFieldNumber = 7,
+    kP999MsFieldNumber = 8,
+    kMaxMsFieldNumber = 9,
+  };
+  // string phase = 1;
+  void clear_phase();
+  const std::string& phase() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_phase(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_phase();
+  PROTOBUF_NODISCARD std::string* release_phase();
+  void set_allocated_phase(std::string* phase);
+  private:
+  const std::string& _internal_phase() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_phase(const std::string& value);
+  std::string* _internal_mutable_phase();
+  public:
+
+  // string priority = 2;
+  void clear_priority();
+  const std::string& priority() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_priority(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_priority();
+  PROTOBUF_NODISCARD std::string* release_priority();
+  void set_allocated_priority(std::string* priority);
+  private:
+  const std::string& _internal_priority() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_priority(const std::string& value);
+  std::string* _internal_mutable_priority();
+  public:
+
+  // uint64 count = 3;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // float mean_ms = 4;
+  void clear_mean_ms();
+  float mean_ms() const;
+  void set_mean_ms(float value);
+  private:
+  float _internal_mean_ms() const;
+  void _internal_set_mean_ms(float value);
+  public:
+
+  // float p50_ms = 5;
+  void clear_p50_ms();
+  float p50_ms() const;
+  void set_p50_ms(float value);
+  private:
+  float _internal_p50_ms() const;
+  void _internal_set_p50_ms(float value);
+  public:
+
+  // float p90_ms = 6;
+  void clear_p90_ms();
+  float p90_ms() const;
+  void set_p90_ms(float value);
+  private:
+  float _internal_p90_ms() const;
+  void _internal_set_p90_ms(float value);
+  public:
+
+  // float p99_ms = 7;
+  void clear_p99_ms();
+  float p99_ms() const;
+  void set_p99_ms(float value);
+  private:
+  float _internal_p99_ms() const;
+  void _internal_set_p99_ms(float value);
+  public:
+
+  // float p999_ms = 8;
+  void clear_p999_ms();
+  float p999_ms() const;
+  void set_p999_ms(float value);
+  private:
+  float _internal_p999_ms() const;
+  void _internal_set_p999_ms(float value);
+  public:
+
+  // float max_ms = 9;
+  void clear_max_ms();
+  float max_ms() const;
+  void set_max_ms(float value);
+  private:
+  float _internal_max_ms() const;
+  void _internal_set_max_ms(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.PhaseLatency)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phase_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr priority_;
+    uint64_t count_;
+    float mean_ms_;
+    float p50_ms_;
+    float p90_ms_;
+    float p99_ms_;
+    float p999_ms_;
+    float max_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Metric final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.Metric) */ {
+ public:
+  inline Metric() : Metric(nullptr) {}
+  ~Metric() override;
+  explicit PROTOBUF_CONSTEXPR Metric(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Metric(const Metric& from);
+  Metric(Metric&& from) noexcept
+    : Metric() {
+    *this = ::std::move(from);
+  }
+
+  inline Metric& operator=(const Metric& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Metric& operator=(Metric&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Metric& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Metric* internal_default_instance() {
+    return reinterpret_cast<const Metric*>(
+               &_Metric_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(Metric& a, Metric& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Metric* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Metric* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Metric* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Metric>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Metric& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Metric& from) {
+    Metric::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Metric* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.Metric";
+  }
+  protected:
+  explicit Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketBoundsFieldNumber = 5,
+    kBucketCountsFieldNumber = 6,
+    kNameFieldNumber = 1,
+    kLabelsFieldNumber = 2,
+    kTypeFieldNumber = 3,
+    kValueFieldNumber = 4,
+    kSumFieldNumber = 7,
+    kCountFieldNumber = 8,
+  };
+  // repeated double bucket_bounds = 5;
+  int bucket_bounds_size() const;
+  private:
+  int _internal_bucket_bounds_size() const;
+  public:
+  void clear_bucket_bounds();
+  private:
+  double _internal_bucket_bounds(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_bucket_bounds() const;
+  void _internal_add_bucket_bounds(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_bucket_bounds();
+  public:
+  double bucket_bounds(int index) const;
+  void set_bucket_bounds(int index, double value);
+  void add_bucket_bounds(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      bucket_bounds() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_bucket_bounds();
+
+  // repeated uint64 bucket_counts = 6;
+  int bucket_counts_size() const;
+  private:
+  int _internal_bucket_counts_size() const;
+  public:
+  void clear_bucket_counts();
+  private:
+  uint64_t _internal_bucket_counts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_bucket_counts() const;
+  void _internal_add_bucket_counts(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_bucket_counts();
+  public:
+  uint64_t bucket_counts(int index) const;
+  void set_bucket_counts(int index, uint64_t value);
+  void add_bucket_counts(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      bucket_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_bucket_counts();
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string labels = 2;
+  void clear_labels();
+  const std::string& labels() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_labels(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_labels();
+  PROTOBUF_NODISCARD std::string* release_labels();
+  void set_allocated_labels(std::string* labels);
+  private:
+  const std::string& _internal_labels() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_labels(const std::string& value);
+  std::string* _internal_mutable_labels();
+  public:
+
+  // string type = 3;
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // double value = 4;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // double sum = 7;
+  void clear_sum();
+  double sum() const;
+  void set_sum(double value);
+  private:
+  double _internal_sum() const;
+  void _internal_set_sum(double value);
+  public:
+
+  // uint64 count = 8;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.Metric)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > bucket_bounds_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > bucket_counts_;
+    mutable std::atomic<int> _bucket_counts_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr labels_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    double value_;
+    double sum_;
+    uint64_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TraceRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.TraceRequest) */ {
+ public:
+  inline TraceRequest() : TraceRequest(nullptr) {}
+  ~TraceRequest() override;
+  explicit PROTOBUF_CONSTEXPR TraceRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TraceRequest(const TraceRequest& from);
+  TraceRequest(TraceRequest&& from) noexcept
+    : TraceRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TraceRequest& operator=(const TraceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TraceRequest& operator=(TraceRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TraceRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TraceRequest* internal_default_instance() {
+    return reinterpret_cast<const TraceRequest*>(
+               &_TraceRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(TraceRequest& a, TraceRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TraceRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TraceRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TraceRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TraceRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TraceRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TraceRequest& from) {
+    TraceRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TraceRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.TraceRequest";
+  }
+  protected:
+  explicit TraceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEnableFieldNumber = 1,
+    kCollectFieldNumber = 2,
+  };
+  // bool enable = 1;
+  void clear_enable();
+  bool enable() const;
+  void set_enable(bool value);
+  private:
+  bool _internal_enable() const;
+  void _internal_set_enable(bool value);
+  public:
+
+  // bool collect = 2;
+  void clear_collect();
+  bool collect() const;
+  void set_collect(bool value);
+  private:
+  bool _internal_collect() const;
+  void _internal_set_collect(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.TraceRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool enable_;
+    bool collect_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TraceReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:leader.TraceReply) */ {
+ public:
+  inline TraceReply() : TraceReply(nullptr) {}
+  ~TraceReply() override;
+  explicit PROTOBUF_CONSTEXPR TraceReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TraceReply(const TraceReply& from);
+  TraceReply(TraceReply&& from) noexcept
+    : TraceReply() {
+    *this = ::std::move(from);
+  }
+
+  inline TraceReply& operator=(const TraceReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TraceReply& operator=(TraceReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TraceReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TraceReply* internal_default_instance() {
+    return reinterpret_cast<const TraceReply*>(
+               &_TraceReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(TraceReply& a, TraceReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TraceReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TraceReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TraceReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TraceReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TraceReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TraceReply& from) {
+    TraceReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TraceReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "leader.TraceReply";
+  }
+  protected:
+  explicit TraceReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodeIdFieldNumber = 1,
+    kEventsJsonFieldNumber = 2,
+    kEventsFieldNumber = 3,
+    kDroppedFieldNumber = 4,
+  };
+  // string node_id = 1;
+  void clear_node_id();
+  const std::string& node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_id();
+  PROTOBUF_NODISCARD std::string* release_node_id();
+  void set_allocated_node_id(std::string* node_id);
+  private:
+  const std::string& _internal_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_id(const std::string& value);
+  std::string* _internal_mutable_node_id();
+  public:
+
+  // string events_json = 2;
+  void clear_events_json();
+  const std::string& events_json() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_events_json(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_events_json();
+  PROTOBUF_NODISCARD std::string* release_events_json();
+  void set_allocated_events_json(std::string* events_json);
+  private:
+  const std::string& _internal_events_json() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_events_json(const std::string& value);
+  std::string* _internal_mutable_events_json();
+  public:
+
+  // int64 events = 3;
+  void clear_events();
+  int64_t events() const;
+  void set_events(int64_t value);
+  private:
+  int64_t _internal_events() const;
+  void _internal_set_events(int64_t value);
+  public:
+
+  // int64 dropped = 4;
+  void clear_dropped();
+  int64_t dropped() const;
+  void set_dropped(int64_t value);
+  private:
+  int64_t _internal_dropped() const;
+  void _internal_set_dropped(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:leader.TraceReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr events_json_;
+    int64_t events_;
+    int64_t dropped_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_leader_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// NodeStatus
+
+// string node_id = 1;
+inline void NodeStatus::clear_node_id() {
+  _impl_.node_id_.ClearToEmpty();
+}
+inline const std::string& NodeStatus::node_id() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.node_id)
+  return _internal_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeStatus::set_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.node_id)
+}
+inline std::string* NodeStatus::mutable_node_id() {
+  std::string* _s = _internal_mutable_node_id();
+  // @@protoc_insertion_point(field_mutable:leader.NodeStatus.node_id)
+  return _s;
+}
+inline const std::string& NodeStatus::_internal_node_id() const {
+  return _impl_.node_id_.Get();
+}
+inline void NodeStatus::_internal_set_node_id(const std::string& value) {
+  
+  _impl_.node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NodeStatus::_internal_mutable_node_id() {
+  
+  return _impl_.node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NodeStatus::release_node_id() {
+  // @@protoc_insertion_point(field_release:leader.NodeStatus.node_id)
+  return _impl_.node_id_.Release();
+}
+inline void NodeStatus::set_allocated_node_id(std::string* node_id) {
+  if (node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_id_.SetAllocated(node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_id_.IsDefault()) {
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.NodeStatus.node_id)
+}
+
+// float score = 2;
+inline void NodeStatus::clear_score() {
+  _impl_.score_ = 0;
+}
+inline float NodeStatus::_internal_score() const {
+  return _impl_.score_;
+}
+inline float NodeStatus::score() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.score)
+  return _internal_score();
+}
+inline void NodeStatus::_internal_set_score(float value) {
+  
+  _impl_.score_ = value;
+}
+inline void NodeStatus::set_score(float value) {
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.score)
+}
+
+// int32 queue_length = 3;
+inline void NodeStatus::clear_queue_length() {
+  _impl_.queue_length_ = 0;
+}
+inline int32_t NodeStatus::_internal_queue_length() const {
+  return _impl_.queue_length_;
+}
+inline int32_t NodeStatus::queue_length() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.queue_length)
+  return _internal_queue_length();
+}
+inline void NodeStatus::_internal_set_queue_length(int32_t value) {
+  
+  _impl_.queue_length_ = value;
+}
+inline void NodeStatus::set_queue_length(int32_t value) {
+  _internal_set_queue_length(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.queue_length)
+}
+
+// float expected_wait_ms = 4;
+inline void NodeStatus::clear_expected_wait_ms() {
+  _impl_.expected_wait_ms_ = 0;
+}
+inline float NodeStatus::_internal_expected_wait_ms() const {
+  return _impl_.expected_wait_ms_;
+}
+inline float NodeStatus::expected_wait_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.expected_wait_ms)
+  return _internal_expected_wait_ms();
+}
+inline void NodeStatus::_internal_set_expected_wait_ms(float value) {
+  
+  _impl_.expected_wait_ms_ = value;
+}
+inline void NodeStatus::set_expected_wait_ms(float value) {
+  _internal_set_expected_wait_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.expected_wait_ms)
+}
+
+// float drain_ms = 5;
+inline void NodeStatus::clear_drain_ms() {
+  _impl_.drain_ms_ = 0;
+}
+inline float NodeStatus::_internal_drain_ms() const {
+  return _impl_.drain_ms_;
+}
+inline float NodeStatus::drain_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.drain_ms)
+  return _internal_drain_ms();
+}
+inline void NodeStatus::_internal_set_drain_ms(float value) {
+  
+  _impl_.drain_ms_ = value;
+}
+inline void NodeStatus::set_drain_ms(float value) {
+  _internal_set_drain_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.drain_ms)
+}
+
+// int64 backlog_ms = 6;
+inline void NodeStatus::clear_backlog_ms() {
+  _impl_.backlog_ms_ = int64_t{0};
+}
+inline int64_t NodeStatus::_internal_backlog_ms() const {
+  return _impl_.backlog_ms_;
+}
+inline int64_t NodeStatus::backlog_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.backlog_ms)
+  return _internal_backlog_ms();
+}
+inline void NodeStatus::_internal_set_backlog_ms(int64_t value) {
+  
+  _impl_.backlog_ms_ = value;
+}
+inline void NodeStatus::set_backlog_ms(int64_t value) {
+  _internal_set_backlog_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.backlog_ms)
+}
+
+// float capacity = 7;
+inline void NodeStatus::clear_capacity() {
+  _impl_.capacity_ = 0;
+}
+inline float NodeStatus::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline float NodeStatus::capacity() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.capacity)
+  return _internal_capacity();
+}
+inline void NodeStatus::_internal_set_capacity(float value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void NodeStatus::set_capacity(float value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.capacity)
+}
+
+// float service_rate = 8;
+inline void NodeStatus::clear_service_rate() {
+  _impl_.service_rate_ = 0;
+}
+inline float NodeStatus::_internal_service_rate() const {
+  return _impl_.service_rate_;
+}
+inline float NodeStatus::service_rate() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.service_rate)
+  return _internal_service_rate();
+}
+inline void NodeStatus::_internal_set_service_rate(float value) {
+  
+  _impl_.service_rate_ = value;
+}
+inline void NodeStatus::set_service_rate(float value) {
+  _internal_set_service_rate(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.service_rate)
+}
+
+// float service_p99_ms = 9;
+inline void NodeStatus::clear_service_p99_ms() {
+  _impl_.service_p99_ms_ = 0;
+}
+inline float NodeStatus::_internal_service_p99_ms() const {
+  return _impl_.service_p99_ms_;
+}
+inline float NodeStatus::service_p99_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStatus.service_p99_ms)
+  return _internal_service_p99_ms();
+}
+inline void NodeStatus::_internal_set_service_p99_ms(float value) {
+  
+  _impl_.service_p99_ms_ = value;
+}
+inline void NodeStatus::set_service_p99_ms(float value) {
+  _internal_set_service_p99_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStatus.service_p99_ms)
+}
+
+// -------------------------------------------------------------------
+
+// Task
+
+// int32 task_id = 1;
+inline void Task::clear_task_id() {
+  _impl_.task_id_ = 0;
+}
+inline int32_t Task::_internal_task_id() const {
+  return _impl_.task_id_;
+}
+inline int32_t Task::task_id() const {
   // @@protoc_insertion_point(field_get:leader.Task.task_id)
   return _internal_task_id();
 }
-inline void Task::_internal_set_task_id(int32_t value) {
+inline void Task::_internal_set_task_id(int32_t value) {
+  
+  _impl_.task_id_ = value;
+}
+inline void Task::set_task_id(int32_t value) {
+  _internal_set_task_id(value);
+  // @@protoc_insertion_point(field_set:leader.Task.task_id)
+}
+
+// int32 duration_ms = 2;
+inline void Task::clear_duration_ms() {
+  _impl_.duration_ms_ = 0;
+}
+inline int32_t Task::_internal_duration_ms() const {
+  return _impl_.duration_ms_;
+}
+inline int32_t Task::duration_ms() const {
+  // @@protoc_insertion_point(field_get:leader.Task.duration_ms)
+  return _internal_duration_ms();
+}
+inline void Task::_internal_set_duration_ms(int32_t value) {
+  
+  _impl_.duration_ms_ = value;
+}
+inline void Task::set_duration_ms(int32_t value) {
+  _internal_set_duration_ms(value);
+  // @@protoc_insertion_point(field_set:leader.Task.duration_ms)
+}
+
+// bool forwarded = 3;
+inline void Task::clear_forwarded() {
+  _impl_.forwarded_ = false;
+}
+inline bool Task::_internal_forwarded() const {
+  return _impl_.forwarded_;
+}
+inline bool Task::forwarded() const {
+  // @@protoc_insertion_point(field_get:leader.Task.forwarded)
+  return _internal_forwarded();
+}
+inline void Task::_internal_set_forwarded(bool value) {
+  
+  _impl_.forwarded_ = value;
+}
+inline void Task::set_forwarded(bool value) {
+  _internal_set_forwarded(value);
+  // @@protoc_insertion_point(field_set:leader.Task.forwarded)
+}
+
+// string routing_key = 4;
+inline void Task::clear_routing_key() {
+  _impl_.routing_key_.ClearToEmpty();
+}
+inline const std::string& Task::routing_key() const {
+  // @@protoc_insertion_point(field_get:leader.Task.routing_key)
+  return _internal_routing_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Task::set_routing_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.routing_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.Task.routing_key)
+}
+inline std::string* Task::mutable_routing_key() {
+  std::string* _s = _internal_mutable_routing_key();
+  // @@protoc_insertion_point(field_mutable:leader.Task.routing_key)
+  return _s;
+}
+inline const std::string& Task::_internal_routing_key() const {
+  return _impl_.routing_key_.Get();
+}
+inline void Task::_internal_set_routing_key(const std::string& value) {
+  
+  _impl_.routing_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Task::_internal_mutable_routing_key() {
+  
+  return _impl_.routing_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Task::release_routing_key() {
+  // @@protoc_insertion_point(field_release:leader.Task.routing_key)
+  return _impl_.routing_key_.Release();
+}
+inline void Task::set_allocated_routing_key(std::string* routing_key) {
+  if (routing_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.routing_key_.SetAllocated(routing_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.routing_key_.IsDefault()) {
+    _impl_.routing_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.Task.routing_key)
+}
+
+// int32 priority = 5;
+inline void Task::clear_priority() {
+  _impl_.priority_ = 0;
+}
+inline int32_t Task::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline int32_t Task::priority() const {
+  // @@protoc_insertion_point(field_get:leader.Task.priority)
+  return _internal_priority();
+}
+inline void Task::_internal_set_priority(int32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void Task::set_priority(int32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:leader.Task.priority)
+}
+
+// int64 received_us = 6;
+inline void Task::clear_received_us() {
+  _impl_.received_us_ = int64_t{0};
+}
+inline int64_t Task::_internal_received_us() const {
+  return _impl_.received_us_;
+}
+inline int64_t Task::received_us() const {
+  // @@protoc_insertion_point(field_get:leader.Task.received_us)
+  return _internal_received_us();
+}
+inline void Task::_internal_set_received_us(int64_t value) {
+  
+  _impl_.received_us_ = value;
+}
+inline void Task::set_received_us(int64_t value) {
+  _internal_set_received_us(value);
+  // @@protoc_insertion_point(field_set:leader.Task.received_us)
+}
+
+// uint64 trace_id = 7;
+inline void Task::clear_trace_id() {
+  _impl_.trace_id_ = uint64_t{0u};
+}
+inline uint64_t Task::_internal_trace_id() const {
+  return _impl_.trace_id_;
+}
+inline uint64_t Task::trace_id() const {
+  // @@protoc_insertion_point(field_get:leader.Task.trace_id)
+  return _internal_trace_id();
+}
+inline void Task::_internal_set_trace_id(uint64_t value) {
+  
+  _impl_.trace_id_ = value;
+}
+inline void Task::set_trace_id(uint64_t value) {
+  _internal_set_trace_id(value);
+  // @@protoc_insertion_point(field_set:leader.Task.trace_id)
+}
+
+// string tenant = 8;
+inline void Task::clear_tenant() {
+  _impl_.tenant_.ClearToEmpty();
+}
+inline const std::string& Task::tenant() const {
+  // @@protoc_insertion_point(field_get:leader.Task.tenant)
+  return _internal_tenant();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Task::set_tenant(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tenant_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.Task.tenant)
+}
+inline std::string* Task::mutable_tenant() {
+  std::string* _s = _internal_mutable_tenant();
+  // @@protoc_insertion_point(field_mutable:leader.Task.tenant)
+  return _s;
+}
+inline const std::string& Task::_internal_tenant() const {
+  return _impl_.tenant_.Get();
+}
+inline void Task::_internal_set_tenant(const std::string& value) {
+  
+  _impl_.tenant_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Task::_internal_mutable_tenant() {
+  
+  return _impl_.tenant_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Task::release_tenant() {
+  // @@protoc_insertion_point(field_release:leader.Task.tenant)
+  return _impl_.tenant_.Release();
+}
+inline void Task::set_allocated_tenant(std::string* tenant) {
+  if (tenant != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.tenant_.SetAllocated(tenant, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tenant_.IsDefault()) {
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.Task.tenant)
+}
+
+// -------------------------------------------------------------------
+
+// StealRequest
+
+// string node_id = 1;
+inline void StealRequest::clear_node_id() {
+  _impl_.node_id_.ClearToEmpty();
+}
+inline const std::string& StealRequest::node_id() const {
+  // @@protoc_insertion_point(field_get:leader.StealRequest.node_id)
+  return _internal_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StealRequest::set_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.StealRequest.node_id)
+}
+inline std::string* StealRequest::mutable_node_id() {
+  std::string* _s = _internal_mutable_node_id();
+  // @@protoc_insertion_point(field_mutable:leader.StealRequest.node_id)
+  return _s;
+}
+inline const std::string& StealRequest::_internal_node_id() const {
+  return _impl_.node_id_.Get();
+}
+inline void StealRequest::_internal_set_node_id(const std::string& value) {
+  
+  _impl_.node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StealRequest::_internal_mutable_node_id() {
+  
+  return _impl_.node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StealRequest::release_node_id() {
+  // @@protoc_insertion_point(field_release:leader.StealRequest.node_id)
+  return _impl_.node_id_.Release();
+}
+inline void StealRequest::set_allocated_node_id(std::string* node_id) {
+  if (node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_id_.SetAllocated(node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_id_.IsDefault()) {
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.StealRequest.node_id)
+}
+
+// int32 max_tasks = 2;
+inline void StealRequest::clear_max_tasks() {
+  _impl_.max_tasks_ = 0;
+}
+inline int32_t StealRequest::_internal_max_tasks() const {
+  return _impl_.max_tasks_;
+}
+inline int32_t StealRequest::max_tasks() const {
+  // @@protoc_insertion_point(field_get:leader.StealRequest.max_tasks)
+  return _internal_max_tasks();
+}
+inline void StealRequest::_internal_set_max_tasks(int32_t value) {
+  
+  _impl_.max_tasks_ = value;
+}
+inline void StealRequest::set_max_tasks(int32_t value) {
+  _internal_set_max_tasks(value);
+  // @@protoc_insertion_point(field_set:leader.StealRequest.max_tasks)
+}
+
+// -------------------------------------------------------------------
+
+// StealReply
+
+// int32 tasks = 1;
+inline void StealReply::clear_tasks() {
+  _impl_.tasks_ = 0;
+}
+inline int32_t StealReply::_internal_tasks() const {
+  return _impl_.tasks_;
+}
+inline int32_t StealReply::tasks() const {
+  // @@protoc_insertion_point(field_get:leader.StealReply.tasks)
+  return _internal_tasks();
+}
+inline void StealReply::_internal_set_tasks(int32_t value) {
+  
+  _impl_.tasks_ = value;
+}
+inline void StealReply::set_tasks(int32_t value) {
+  _internal_set_tasks(value);
+  // @@protoc_insertion_point(field_set:leader.StealReply.tasks)
+}
+
+// -------------------------------------------------------------------
+
+// TaskBatch
+
+// repeated .leader.Task tasks = 1;
+inline int TaskBatch::_internal_tasks_size() const {
+  return _impl_.tasks_.size();
+}
+inline int TaskBatch::tasks_size() const {
+  return _internal_tasks_size();
+}
+inline void TaskBatch::clear_tasks() {
+  _impl_.tasks_.Clear();
+}
+inline ::leader::Task* TaskBatch::mutable_tasks(int index) {
+  // @@protoc_insertion_point(field_mutable:leader.TaskBatch.tasks)
+  return _impl_.tasks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Task >*
+TaskBatch::mutable_tasks() {
+  // @@protoc_insertion_point(field_mutable_list:leader.TaskBatch.tasks)
+  return &_impl_.tasks_;
+}
+inline const ::leader::Task& TaskBatch::_internal_tasks(int index) const {
+  return _impl_.tasks_.Get(index);
+}
+inline const ::leader::Task& TaskBatch::tasks(int index) const {
+  // @@protoc_insertion_point(field_get:leader.TaskBatch.tasks)
+  return _internal_tasks(index);
+}
+inline ::leader::Task* TaskBatch::_internal_add_tasks() {
+  return _impl_.tasks_.Add();
+}
+inline ::leader::Task* TaskBatch::add_tasks() {
+  ::leader::Task* _add = _internal_add_tasks();
+  // @@protoc_insertion_point(field_add:leader.TaskBatch.tasks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Task >&
+TaskBatch::tasks() const {
+  // @@protoc_insertion_point(field_list:leader.TaskBatch.tasks)
+  return _impl_.tasks_;
+}
+
+// -------------------------------------------------------------------
+
+// Ack
+
+// string message = 1;
+inline void Ack::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& Ack::message() const {
+  // @@protoc_insertion_point(field_get:leader.Ack.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Ack::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.Ack.message)
+}
+inline std::string* Ack::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:leader.Ack.message)
+  return _s;
+}
+inline const std::string& Ack::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void Ack::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Ack::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Ack::release_message() {
+  // @@protoc_insertion_point(field_release:leader.Ack.message)
+  return _impl_.message_.Release();
+}
+inline void Ack::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.Ack.message)
+}
+
+// -------------------------------------------------------------------
+
+// StatsRequest
+
+// -------------------------------------------------------------------
+
+// NodeStats
+
+// string node_id = 1;
+inline void NodeStats::clear_node_id() {
+  _impl_.node_id_.ClearToEmpty();
+}
+inline const std::string& NodeStats::node_id() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.node_id)
+  return _internal_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeStats::set_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.NodeStats.node_id)
+}
+inline std::string* NodeStats::mutable_node_id() {
+  std::string* _s = _internal_mutable_node_id();
+  // @@protoc_insertion_point(field_mutable:leader.NodeStats.node_id)
+  return _s;
+}
+inline const std::string& NodeStats::_internal_node_id() const {
+  return _impl_.node_id_.Get();
+}
+inline void NodeStats::_internal_set_node_id(const std::string& value) {
+  
+  _impl_.node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NodeStats::_internal_mutable_node_id() {
+  
+  return _impl_.node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NodeStats::release_node_id() {
+  // @@protoc_insertion_point(field_release:leader.NodeStats.node_id)
+  return _impl_.node_id_.Release();
+}
+inline void NodeStats::set_allocated_node_id(std::string* node_id) {
+  if (node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_id_.SetAllocated(node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_id_.IsDefault()) {
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.NodeStats.node_id)
+}
+
+// string leader_id = 2;
+inline void NodeStats::clear_leader_id() {
+  _impl_.leader_id_.ClearToEmpty();
+}
+inline const std::string& NodeStats::leader_id() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.leader_id)
+  return _internal_leader_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeStats::set_leader_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.leader_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.NodeStats.leader_id)
+}
+inline std::string* NodeStats::mutable_leader_id() {
+  std::string* _s = _internal_mutable_leader_id();
+  // @@protoc_insertion_point(field_mutable:leader.NodeStats.leader_id)
+  return _s;
+}
+inline const std::string& NodeStats::_internal_leader_id() const {
+  return _impl_.leader_id_.Get();
+}
+inline void NodeStats::_internal_set_leader_id(const std::string& value) {
+  
+  _impl_.leader_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NodeStats::_internal_mutable_leader_id() {
+  
+  return _impl_.leader_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NodeStats::release_leader_id() {
+  // @@protoc_insertion_point(field_release:leader.NodeStats.leader_id)
+  return _impl_.leader_id_.Release();
+}
+inline void NodeStats::set_allocated_leader_id(std::string* leader_id) {
+  if (leader_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.leader_id_.SetAllocated(leader_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_id_.IsDefault()) {
+    _impl_.leader_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.NodeStats.leader_id)
+}
+
+// int32 queue_length = 3;
+inline void NodeStats::clear_queue_length() {
+  _impl_.queue_length_ = 0;
+}
+inline int32_t NodeStats::_internal_queue_length() const {
+  return _impl_.queue_length_;
+}
+inline int32_t NodeStats::queue_length() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.queue_length)
+  return _internal_queue_length();
+}
+inline void NodeStats::_internal_set_queue_length(int32_t value) {
+  
+  _impl_.queue_length_ = value;
+}
+inline void NodeStats::set_queue_length(int32_t value) {
+  _internal_set_queue_length(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.queue_length)
+}
+
+// int64 backlog_ms = 4;
+inline void NodeStats::clear_backlog_ms() {
+  _impl_.backlog_ms_ = int64_t{0};
+}
+inline int64_t NodeStats::_internal_backlog_ms() const {
+  return _impl_.backlog_ms_;
+}
+inline int64_t NodeStats::backlog_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.backlog_ms)
+  return _internal_backlog_ms();
+}
+inline void NodeStats::_internal_set_backlog_ms(int64_t value) {
+  
+  _impl_.backlog_ms_ = value;
+}
+inline void NodeStats::set_backlog_ms(int64_t value) {
+  _internal_set_backlog_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.backlog_ms)
+}
+
+// float capacity = 5;
+inline void NodeStats::clear_capacity() {
+  _impl_.capacity_ = 0;
+}
+inline float NodeStats::_internal_capacity() const {
+  return _impl_.capacity_;
+}
+inline float NodeStats::capacity() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.capacity)
+  return _internal_capacity();
+}
+inline void NodeStats::_internal_set_capacity(float value) {
+  
+  _impl_.capacity_ = value;
+}
+inline void NodeStats::set_capacity(float value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.capacity)
+}
+
+// int64 tasks_completed = 6;
+inline void NodeStats::clear_tasks_completed() {
+  _impl_.tasks_completed_ = int64_t{0};
+}
+inline int64_t NodeStats::_internal_tasks_completed() const {
+  return _impl_.tasks_completed_;
+}
+inline int64_t NodeStats::tasks_completed() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.tasks_completed)
+  return _internal_tasks_completed();
+}
+inline void NodeStats::_internal_set_tasks_completed(int64_t value) {
+  
+  _impl_.tasks_completed_ = value;
+}
+inline void NodeStats::set_tasks_completed(int64_t value) {
+  _internal_set_tasks_completed(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.tasks_completed)
+}
+
+// float arrival_rate = 7;
+inline void NodeStats::clear_arrival_rate() {
+  _impl_.arrival_rate_ = 0;
+}
+inline float NodeStats::_internal_arrival_rate() const {
+  return _impl_.arrival_rate_;
+}
+inline float NodeStats::arrival_rate() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.arrival_rate)
+  return _internal_arrival_rate();
+}
+inline void NodeStats::_internal_set_arrival_rate(float value) {
+  
+  _impl_.arrival_rate_ = value;
+}
+inline void NodeStats::set_arrival_rate(float value) {
+  _internal_set_arrival_rate(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.arrival_rate)
+}
+
+// float service_rate = 8;
+inline void NodeStats::clear_service_rate() {
+  _impl_.service_rate_ = 0;
+}
+inline float NodeStats::_internal_service_rate() const {
+  return _impl_.service_rate_;
+}
+inline float NodeStats::service_rate() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.service_rate)
+  return _internal_service_rate();
+}
+inline void NodeStats::_internal_set_service_rate(float value) {
+  
+  _impl_.service_rate_ = value;
+}
+inline void NodeStats::set_service_rate(float value) {
+  _internal_set_service_rate(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.service_rate)
+}
+
+// float service_mean_ms = 9;
+inline void NodeStats::clear_service_mean_ms() {
+  _impl_.service_mean_ms_ = 0;
+}
+inline float NodeStats::_internal_service_mean_ms() const {
+  return _impl_.service_mean_ms_;
+}
+inline float NodeStats::service_mean_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.service_mean_ms)
+  return _internal_service_mean_ms();
+}
+inline void NodeStats::_internal_set_service_mean_ms(float value) {
+  
+  _impl_.service_mean_ms_ = value;
+}
+inline void NodeStats::set_service_mean_ms(float value) {
+  _internal_set_service_mean_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.service_mean_ms)
+}
+
+// float service_p50_ms = 10;
+inline void NodeStats::clear_service_p50_ms() {
+  _impl_.service_p50_ms_ = 0;
+}
+inline float NodeStats::_internal_service_p50_ms() const {
+  return _impl_.service_p50_ms_;
+}
+inline float NodeStats::service_p50_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.service_p50_ms)
+  return _internal_service_p50_ms();
+}
+inline void NodeStats::_internal_set_service_p50_ms(float value) {
+  
+  _impl_.service_p50_ms_ = value;
+}
+inline void NodeStats::set_service_p50_ms(float value) {
+  _internal_set_service_p50_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.service_p50_ms)
+}
+
+// float service_p90_ms = 11;
+inline void NodeStats::clear_service_p90_ms() {
+  _impl_.service_p90_ms_ = 0;
+}
+inline float NodeStats::_internal_service_p90_ms() const {
+  return _impl_.service_p90_ms_;
+}
+inline float NodeStats::service_p90_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.service_p90_ms)
+  return _internal_service_p90_ms();
+}
+inline void NodeStats::_internal_set_service_p90_ms(float value) {
+  
+  _impl_.service_p90_ms_ = value;
+}
+inline void NodeStats::set_service_p90_ms(float value) {
+  _internal_set_service_p90_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.service_p90_ms)
+}
+
+// float service_p99_ms = 12;
+inline void NodeStats::clear_service_p99_ms() {
+  _impl_.service_p99_ms_ = 0;
+}
+inline float NodeStats::_internal_service_p99_ms() const {
+  return _impl_.service_p99_ms_;
+}
+inline float NodeStats::service_p99_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.service_p99_ms)
+  return _internal_service_p99_ms();
+}
+inline void NodeStats::_internal_set_service_p99_ms(float value) {
+  
+  _impl_.service_p99_ms_ = value;
+}
+inline void NodeStats::set_service_p99_ms(float value) {
+  _internal_set_service_p99_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.service_p99_ms)
+}
+
+// float expected_wait_ms = 13;
+inline void NodeStats::clear_expected_wait_ms() {
+  _impl_.expected_wait_ms_ = 0;
+}
+inline float NodeStats::_internal_expected_wait_ms() const {
+  return _impl_.expected_wait_ms_;
+}
+inline float NodeStats::expected_wait_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.expected_wait_ms)
+  return _internal_expected_wait_ms();
+}
+inline void NodeStats::_internal_set_expected_wait_ms(float value) {
+  
+  _impl_.expected_wait_ms_ = value;
+}
+inline void NodeStats::set_expected_wait_ms(float value) {
+  _internal_set_expected_wait_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.expected_wait_ms)
+}
+
+// float drain_ms = 14;
+inline void NodeStats::clear_drain_ms() {
+  _impl_.drain_ms_ = 0;
+}
+inline float NodeStats::_internal_drain_ms() const {
+  return _impl_.drain_ms_;
+}
+inline float NodeStats::drain_ms() const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.drain_ms)
+  return _internal_drain_ms();
+}
+inline void NodeStats::_internal_set_drain_ms(float value) {
+  
+  _impl_.drain_ms_ = value;
+}
+inline void NodeStats::set_drain_ms(float value) {
+  _internal_set_drain_ms(value);
+  // @@protoc_insertion_point(field_set:leader.NodeStats.drain_ms)
+}
+
+// repeated .leader.Metric metrics = 15;
+inline int NodeStats::_internal_metrics_size() const {
+  return _impl_.metrics_.size();
+}
+inline int NodeStats::metrics_size() const {
+  return _internal_metrics_size();
+}
+inline void NodeStats::clear_metrics() {
+  _impl_.metrics_.Clear();
+}
+inline ::leader::Metric* NodeStats::mutable_metrics(int index) {
+  // @@protoc_insertion_point(field_mutable:leader.NodeStats.metrics)
+  return _impl_.metrics_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Metric >*
+NodeStats::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable_list:leader.NodeStats.metrics)
+  return &_impl_.metrics_;
+}
+inline const ::leader::Metric& NodeStats::_internal_metrics(int index) const {
+  return _impl_.metrics_.Get(index);
+}
+inline const ::leader::Metric& NodeStats::metrics(int index) const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.metrics)
+  return _internal_metrics(index);
+}
+inline ::leader::Metric* NodeStats::_internal_add_metrics() {
+  return _impl_.metrics_.Add();
+}
+inline ::leader::Metric* NodeStats::add_metrics() {
+  ::leader::Metric* _add = _internal_add_metrics();
+  // @@protoc_insertion_point(field_add:leader.NodeStats.metrics)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::Metric >&
+NodeStats::metrics() const {
+  // @@protoc_insertion_point(field_list:leader.NodeStats.metrics)
+  return _impl_.metrics_;
+}
+
+// repeated .leader.PhaseLatency latency = 16;
+inline int NodeStats::_internal_latency_size() const {
+  return _impl_.latency_.size();
+}
+inline int NodeStats::latency_size() const {
+  return _internal_latency_size();
+}
+inline void NodeStats::clear_latency() {
+  _impl_.latency_.Clear();
+}
+inline ::leader::PhaseLatency* NodeStats::mutable_latency(int index) {
+  // @@protoc_insertion_point(field_mutable:leader.NodeStats.latency)
+  return _impl_.latency_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::PhaseLatency >*
+NodeStats::mutable_latency() {
+  // @@protoc_insertion_point(field_mutable_list:leader.NodeStats.latency)
+  return &_impl_.latency_;
+}
+inline const ::leader::PhaseLatency& NodeStats::_internal_latency(int index) const {
+  return _impl_.latency_.Get(index);
+}
+inline const ::leader::PhaseLatency& NodeStats::latency(int index) const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.latency)
+  return _internal_latency(index);
+}
+inline ::leader::PhaseLatency* NodeStats::_internal_add_latency() {
+  return _impl_.latency_.Add();
+}
+inline ::leader::PhaseLatency* NodeStats::add_latency() {
+  ::leader::PhaseLatency* _add = _internal_add_latency();
+  // @@protoc_insertion_point(field_add:leader.NodeStats.latency)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::PhaseLatency >&
+NodeStats::latency() const {
+  // @@protoc_insertion_point(field_list:leader.NodeStats.latency)
+  return _impl_.latency_;
+}
+
+// repeated .leader.LockProfile locks = 17;
+inline int NodeStats::_internal_locks_size() const {
+  return _impl_.locks_.size();
+}
+inline int NodeStats::locks_size() const {
+  return _internal_locks_size();
+}
+inline void NodeStats::clear_locks() {
+  _impl_.locks_.Clear();
+}
+inline ::leader::LockProfile* NodeStats::mutable_locks(int index) {
+  // @@protoc_insertion_point(field_mutable:leader.NodeStats.locks)
+  return _impl_.locks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::LockProfile >*
+NodeStats::mutable_locks() {
+  // @@protoc_insertion_point(field_mutable_list:leader.NodeStats.locks)
+  return &_impl_.locks_;
+}
+inline const ::leader::LockProfile& NodeStats::_internal_locks(int index) const {
+  return _impl_.locks_.Get(index);
+}
+inline const ::leader::LockProfile& NodeStats::locks(int index) const {
+  // @@protoc_insertion_point(field_get:leader.NodeStats.locks)
+  return _internal_locks(index);
+}
+inline ::leader::LockProfile* NodeStats::_internal_add_locks() {
+  return _impl_.locks_.Add();
+}
+inline ::leader::LockProfile* NodeStats::add_locks() {
+  ::leader::LockProfile* _add = _internal_add_locks();
+  // @@protoc_insertion_point(field_add:leader.NodeStats.locks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::leader::LockProfile >&
+NodeStats::locks() const {
+  // @@protoc_insertion_point(field_list:leader.NodeStats.locks)
+  return _impl_.locks_;
+}
+
+// -------------------------------------------------------------------
+
+// LockProfile
+
+// string lock = 1;
+inline void LockProfile::clear_lock() {
+  _impl_.lock_.ClearToEmpty();
+}
+inline const std::string& LockProfile::lock() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.lock)
+  return _internal_lock();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LockProfile::set_lock(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.lock_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.LockProfile.lock)
+}
+inline std::string* LockProfile::mutable_lock() {
+  std::string* _s = _internal_mutable_lock();
+  // @@protoc_insertion_point(field_mutable:leader.LockProfile.lock)
+  return _s;
+}
+inline const std::string& LockProfile::_internal_lock() const {
+  return _impl_.lock_.Get();
+}
+inline void LockProfile::_internal_set_lock(const std::string& value) {
+  
+  _impl_.lock_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LockProfile::_internal_mutable_lock() {
+  
+  return _impl_.lock_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LockProfile::release_lock() {
+  // @@protoc_insertion_point(field_release:leader.LockProfile.lock)
+  return _impl_.lock_.Release();
+}
+inline void LockProfile::set_allocated_lock(std::string* lock) {
+  if (lock != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.lock_.SetAllocated(lock, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lock_.IsDefault()) {
+    _impl_.lock_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.LockProfile.lock)
+}
+
+// string site = 2;
+inline void LockProfile::clear_site() {
+  _impl_.site_.ClearToEmpty();
+}
+inline const std::string& LockProfile::site() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.site)
+  return _internal_site();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LockProfile::set_site(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.site_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.LockProfile.site)
+}
+inline std::string* LockProfile::mutable_site() {
+  std::string* _s = _internal_mutable_site();
+  // @@protoc_insertion_point(field_mutable:leader.LockProfile.site)
+  return _s;
+}
+inline const std::string& LockProfile::_internal_site() const {
+  return _impl_.site_.Get();
+}
+inline void LockProfile::_internal_set_site(const std::string& value) {
+  
+  _impl_.site_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LockProfile::_internal_mutable_site() {
+  
+  return _impl_.site_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LockProfile::release_site() {
+  // @@protoc_insertion_point(field_release:leader.LockProfile.site)
+  return _impl_.site_.Release();
+}
+inline void LockProfile::set_allocated_site(std::string* site) {
+  if (site != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.site_.SetAllocated(site, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.site_.IsDefault()) {
+    _impl_.site_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.LockProfile.site)
+}
+
+// int64 acquisitions = 3;
+inline void LockProfile::clear_acquisitions() {
+  _impl_.acquisitions_ = int64_t{0};
+}
+inline int64_t LockProfile::_internal_acquisitions() const {
+  return _impl_.acquisitions_;
+}
+inline int64_t LockProfile::acquisitions() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.acquisitions)
+  return _internal_acquisitions();
+}
+inline void LockProfile::_internal_set_acquisitions(int64_t value) {
+  
+  _impl_.acquisitions_ = value;
+}
+inline void LockProfile::set_acquisitions(int64_t value) {
+  _internal_set_acquisitions(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.acquisitions)
+}
+
+// int64 contended = 4;
+inline void LockProfile::clear_contended() {
+  _impl_.contended_ = int64_t{0};
+}
+inline int64_t LockProfile::_internal_contended() const {
+  return _impl_.contended_;
+}
+inline int64_t LockProfile::contended() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.contended)
+  return _internal_contended();
+}
+inline void LockProfile::_internal_set_contended(int64_t value) {
+  
+  _impl_.contended_ = value;
+}
+inline void LockProfile::set_contended(int64_t value) {
+  _internal_set_contended(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.contended)
+}
+
+// double wait_total_ms = 5;
+inline void LockProfile::clear_wait_total_ms() {
+  _impl_.wait_total_ms_ = 0;
+}
+inline double LockProfile::_internal_wait_total_ms() const {
+  return _impl_.wait_total_ms_;
+}
+inline double LockProfile::wait_total_ms() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.wait_total_ms)
+  return _internal_wait_total_ms();
+}
+inline void LockProfile::_internal_set_wait_total_ms(double value) {
+  
+  _impl_.wait_total_ms_ = value;
+}
+inline void LockProfile::set_wait_total_ms(double value) {
+  _internal_set_wait_total_ms(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.wait_total_ms)
+}
+
+// float wait_p50_us = 6;
+inline void LockProfile::clear_wait_p50_us() {
+  _impl_.wait_p50_us_ = 0;
+}
+inline float LockProfile::_internal_wait_p50_us() const {
+  return _impl_.wait_p50_us_;
+}
+inline float LockProfile::wait_p50_us() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.wait_p50_us)
+  return _internal_wait_p50_us();
+}
+inline void LockProfile::_internal_set_wait_p50_us(float value) {
+  
+  _impl_.wait_p50_us_ = value;
+}
+inline void LockProfile::set_wait_p50_us(float value) {
+  _internal_set_wait_p50_us(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.wait_p50_us)
+}
+
+// float wait_p99_us = 7;
+inline void LockProfile::clear_wait_p99_us() {
+  _impl_.wait_p99_us_ = 0;
+}
+inline float LockProfile::_internal_wait_p99_us() const {
+  return _impl_.wait_p99_us_;
+}
+inline float LockProfile::wait_p99_us() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.wait_p99_us)
+  return _internal_wait_p99_us();
+}
+inline void LockProfile::_internal_set_wait_p99_us(float value) {
+  
+  _impl_.wait_p99_us_ = value;
+}
+inline void LockProfile::set_wait_p99_us(float value) {
+  _internal_set_wait_p99_us(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.wait_p99_us)
+}
+
+// float wait_max_us = 8;
+inline void LockProfile::clear_wait_max_us() {
+  _impl_.wait_max_us_ = 0;
+}
+inline float LockProfile::_internal_wait_max_us() const {
+  return _impl_.wait_max_us_;
+}
+inline float LockProfile::wait_max_us() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.wait_max_us)
+  return _internal_wait_max_us();
+}
+inline void LockProfile::_internal_set_wait_max_us(float value) {
+  
+  _impl_.wait_max_us_ = value;
+}
+inline void LockProfile::set_wait_max_us(float value) {
+  _internal_set_wait_max_us(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.wait_max_us)
+}
+
+// float hold_p50_us = 9;
+inline void LockProfile::clear_hold_p50_us() {
+  _impl_.hold_p50_us_ = 0;
+}
+inline float LockProfile::_internal_hold_p50_us() const {
+  return _impl_.hold_p50_us_;
+}
+inline float LockProfile::hold_p50_us() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.hold_p50_us)
+  return _internal_hold_p50_us();
+}
+inline void LockProfile::_internal_set_hold_p50_us(float value) {
+  
+  _impl_.hold_p50_us_ = value;
+}
+inline void LockProfile::set_hold_p50_us(float value) {
+  _internal_set_hold_p50_us(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.hold_p50_us)
+}
+
+// float hold_p99_us = 10;
+inline void LockProfile::clear_hold_p99_us() {
+  _impl_.hold_p99_us_ = 0;
+}
+inline float LockProfile::_internal_hold_p99_us() const {
+  return _impl_.hold_p99_us_;
+}
+inline float LockProfile::hold_p99_us() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.hold_p99_us)
+  return _internal_hold_p99_us();
+}
+inline void LockProfile::_internal_set_hold_p99_us(float value) {
+  
+  _impl_.hold_p99_us_ = value;
+}
+inline void LockProfile::set_hold_p99_us(float value) {
+  _internal_set_hold_p99_us(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.hold_p99_us)
+}
+
+// float hold_max_us = 11;
+inline void LockProfile::clear_hold_max_us() {
+  _impl_.hold_max_us_ = 0;
+}
+inline float LockProfile::_internal_hold_max_us() const {
+  return _impl_.hold_max_us_;
+}
+inline float LockProfile::hold_max_us() const {
+  // @@protoc_insertion_point(field_get:leader.LockProfile.hold_max_us)
+  return _internal_hold_max_us();
+}
+inline void LockProfile::_internal_set_hold_max_us(float value) {
+  
+  _impl_.hold_max_us_ = value;
+}
+inline void LockProfile::set_hold_max_us(float value) {
+  _internal_set_hold_max_us(value);
+  // @@protoc_insertion_point(field_set:leader.LockProfile.hold_max_us)
+}
+
+// -------------------------------------------------------------------
+
+// PhaseLatency
+
+// string phase = 1;
+inline void PhaseLatency::clear_phase() {
+  _impl_.phase_.ClearToEmpty();
+}
+inline const std::string& PhaseLatency::phase() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.phase)
+  return _internal_phase();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PhaseLatency::set_phase(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.phase_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.phase)
+}
+inline std::string* PhaseLatency::mutable_phase() {
+  std::string* _s = _internal_mutable_phase();
+  // @@protoc_insertion_point(field_mutable:leader.PhaseLatency.phase)
+  return _s;
+}
+inline const std::string& PhaseLatency::_internal_phase() const {
+  return _impl_.phase_.Get();
+}
+inline void PhaseLatency::_internal_set_phase(const std::string& value) {
+  
+  _impl_.phase_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PhaseLatency::_internal_mutable_phase() {
+  
+  return _impl_.phase_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PhaseLatency::release_phase() {
+  // @@protoc_insertion_point(field_release:leader.PhaseLatency.phase)
+  return _impl_.phase_.Release();
+}
+inline void PhaseLatency::set_allocated_phase(std::string* phase) {
+  if (phase != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.phase_.SetAllocated(phase, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.phase_.IsDefault()) {
+    _impl_.phase_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.PhaseLatency.phase)
+}
+
+// string priority = 2;
+inline void PhaseLatency::clear_priority() {
+  _impl_.priority_.ClearToEmpty();
+}
+inline const std::string& PhaseLatency::priority() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.priority)
+  return _internal_priority();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PhaseLatency::set_priority(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.priority_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.priority)
+}
+inline std::string* PhaseLatency::mutable_priority() {
+  std::string* _s = _internal_mutable_priority();
+  // @@protoc_insertion_point(field_mutable:leader.PhaseLatency.priority)
+  return _s;
+}
+inline const std::string& PhaseLatency::_internal_priority() const {
+  return _impl_.priority_.Get();
+}
+inline void PhaseLatency::_internal_set_priority(const std::string& value) {
+  
+  _impl_.priority_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PhaseLatency::_internal_mutable_priority() {
+  
+  return _impl_.priority_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PhaseLatency::release_priority() {
+  // @@protoc_insertion_point(field_release:leader.PhaseLatency.priority)
+  return _impl_.priority_.Release();
+}
+inline void PhaseLatency::set_allocated_priority(std::string* priority) {
+  if (priority != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.priority_.SetAllocated(priority, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.priority_.IsDefault()) {
+    _impl_.priority_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.PhaseLatency.priority)
+}
+
+// uint64 count = 3;
+inline void PhaseLatency::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t PhaseLatency::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t PhaseLatency::count() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.count)
+  return _internal_count();
+}
+inline void PhaseLatency::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void PhaseLatency::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.count)
+}
+
+// float mean_ms = 4;
+inline void PhaseLatency::clear_mean_ms() {
+  _impl_.mean_ms_ = 0;
+}
+inline float PhaseLatency::_internal_mean_ms() const {
+  return _impl_.mean_ms_;
+}
+inline float PhaseLatency::mean_ms() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.mean_ms)
+  return _internal_mean_ms();
+}
+inline void PhaseLatency::_internal_set_mean_ms(float value) {
+  
+  _impl_.mean_ms_ = value;
+}
+inline void PhaseLatency::set_mean_ms(float value) {
+  _internal_set_mean_ms(value);
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.mean_ms)
+}
+
+// float p50_ms = 5;
+inline void PhaseLatency::clear_p50_ms() {
+  _impl_.p50_ms_ = 0;
+}
+inline float PhaseLatency::_internal_p50_ms() const {
+  return _impl_.p50_ms_;
+}
+inline float PhaseLatency::p50_ms() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.p50_ms)
+  return _internal_p50_ms();
+}
+inline void PhaseLatency::_internal_set_p50_ms(float value) {
+  
+  _impl_.p50_ms_ = value;
+}
+inline void PhaseLatency::set_p50_ms(float value) {
+  _internal_set_p50_ms(value);
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.p50_ms)
+}
+
+// float p90_ms = 6;
+inline void PhaseLatency::clear_p90_ms() {
+  _impl_.p90_ms_ = 0;
+}
+inline float PhaseLatency::_internal_p90_ms() const {
+  return _impl_.p90_ms_;
+}
+inline float PhaseLatency::p90_ms() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.p90_ms)
+  return _internal_p90_ms();
+}
+inline void PhaseLatency::_internal_set_p90_ms(float value) {
+  
+  _impl_.p90_ms_ = value;
+}
+inline void PhaseLatency::set_p90_ms(float value) {
+  _internal_set_p90_ms(value);
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.p90_ms)
+}
+
+// float p99_ms = 7;
+inline void PhaseLatency::clear_p99_ms() {
+  _impl_.p99_ms_ = 0;
+}
+inline float PhaseLatency::_internal_p99_ms() const {
+  return _impl_.p99_ms_;
+}
+inline float PhaseLatency::p99_ms() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.p99_ms)
+  return _internal_p99_ms();
+}
+inline void PhaseLatency::_internal_set_p99_ms(float value) {
+  
+  _impl_.p99_ms_ = value;
+}
+inline void PhaseLatency::set_p99_ms(float value) {
+  _internal_set_p99_ms(value);
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.p99_ms)
+}
+
+// float p999_ms = 8;
+inline void PhaseLatency::clear_p999_ms() {
+  _impl_.p999_ms_ = 0;
+}
+inline float PhaseLatency::_internal_p999_ms() const {
+  return _impl_.p999_ms_;
+}
+inline float PhaseLatency::p999_ms() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.p999_ms)
+  return _internal_p999_ms();
+}
+inline void PhaseLatency::_internal_set_p999_ms(float value) {
   
-  _impl_.task_id_ = value;
+  _impl_.p999_ms_ = value;
 }
-inline void Task::set_task_id(int32_t value) {
-  _internal_set_task_id(value);
-  // @@protoc_insertion_point(field_set:leader.Task.task_id)
+inline void PhaseLatency::set_p999_ms(float value) {
+  _internal_set_p999_ms(value);
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.p999_ms)
 }
 
-// int32 duration_ms = 2;
-inline void Task::clear_duration_ms() {
-  _impl_.duration_ms_ = 0;
+// float max_ms = 9;
+inline void PhaseLatency::clear_max_ms() {
+  _impl_.max_ms_ = 0;
 }
-inline int32_t Task::_internal_duration_ms() const {
-  return _impl_.duration_ms_;
+inline float PhaseLatency::_internal_max_ms() const {
+  return _impl_.max_ms_;
 }
-inline int32_t Task::duration_ms() const {
-  // @@protoc_insertion_point(field_get:leader.Task.duration_ms)
-  return _internal_duration_ms();
+inline float PhaseLatency::max_ms() const {
+  // @@protoc_insertion_point(field_get:leader.PhaseLatency.max_ms)
+  return _internal_max_ms();
 }
-inline void Task::_internal_set_duration_ms(int32_t value) {
+inline void PhaseLatency::_internal_set_max_ms(float value) {
   
-  _impl_.duration_ms_ = value;
+  _impl_.max_ms_ = value;
 }
-inline void Task::set_duration_ms(int32_t value) {
-  _internal_set_duration_ms(value);
-  // @@protoc_insertion_point(field_set:leader.Task.duration_ms)
+inline void PhaseLatency::set_max_ms(float value) {
+  _internal_set_max_ms(value);
+  // @@protoc_insertion_point(field_set:leader.PhaseLatency.max_ms)
 }
 
 // -------------------------------------------------------------------
 
-// Ack
+// Metric
 
-// string message = 1;
-inline void Ack::clear_message() {
-  _impl_.message_.ClearToEmpty();
+// string name = 1;
+inline void Metric::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline const std::string& Ack::message() const {
-  // @@protoc_insertion_point(field_get:leader.Ack.message)
-  return _internal_message();
+inline const std::string& Metric::name() const {
+  // @@protoc_insertion_point(field_get:leader.Metric.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Ack::set_message(ArgT0&& arg0, ArgT... args) {
+void Metric::set_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:leader.Ack.message)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.Metric.name)
 }
-inline std::string* Ack::mutable_message() {
-  std::string* _s = _internal_mutable_message();
-  // @@protoc_insertion_point(field_mutable:leader.Ack.message)
+inline std::string* Metric::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:leader.Metric.name)
   return _s;
 }
-inline const std::string& Ack::_internal_message() const {
-  return _impl_.message_.Get();
+inline const std::string& Metric::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Ack::_internal_set_message(const std::string& value) {
+inline void Metric::_internal_set_name(const std::string& value) {
   
-  _impl_.message_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Ack::_internal_mutable_message() {
+inline std::string* Metric::_internal_mutable_name() {
   
-  return _impl_.message_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Ack::release_message() {
-  // @@protoc_insertion_point(field_release:leader.Ack.message)
-  return _impl_.message_.Release();
+inline std::string* Metric::release_name() {
+  // @@protoc_insertion_point(field_release:leader.Metric.name)
+  return _impl_.name_.Release();
 }
-inline void Ack::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
+inline void Metric::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.message_.IsDefault()) {
-    _impl_.message_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:leader.Ack.message)
+  // @@protoc_insertion_point(field_set_allocated:leader.Metric.name)
+}
+
+// string labels = 2;
+inline void Metric::clear_labels() {
+  _impl_.labels_.ClearToEmpty();
+}
+inline const std::string& Metric::labels() const {
+  // @@protoc_insertion_point(field_get:leader.Metric.labels)
+  return _internal_labels();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Metric::set_labels(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.labels_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.Metric.labels)
+}
+inline std::string* Metric::mutable_labels() {
+  std::string* _s = _internal_mutable_labels();
+  // @@protoc_insertion_point(field_mutable:leader.Metric.labels)
+  return _s;
+}
+inline const std::string& Metric::_internal_labels() const {
+  return _impl_.labels_.Get();
+}
+inline void Metric::_internal_set_labels(const std::string& value) {
+  
+  _impl_.labels_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Metric::_internal_mutable_labels() {
+  
+  return _impl_.labels_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Metric::release_labels() {
+  // @@protoc_insertion_point(field_release:leader.Metric.labels)
+  return _impl_.labels_.Release();
+}
+inline void Metric::set_allocated_labels(std::string* labels) {
+  if (labels != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.labels_.SetAllocated(labels, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.labels_.IsDefault()) {
+    _impl_.labels_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.Metric.labels)
+}
+
+// string type = 3;
+inline void Metric::clear_type() {
+  _impl_.type_.ClearToEmpty();
+}
+inline const std::string& Metric::type() const {
+  // @@protoc_insertion_point(field_get:leader.Metric.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Metric::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.Metric.type)
+}
+inline std::string* Metric::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:leader.Metric.type)
+  return _s;
+}
+inline const std::string& Metric::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void Metric::_internal_set_type(const std::string& value) {
+  
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Metric::_internal_mutable_type() {
+  
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Metric::release_type() {
+  // @@protoc_insertion_point(field_release:leader.Metric.type)
+  return _impl_.type_.Release();
+}
+inline void Metric::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.Metric.type)
+}
+
+// double value = 4;
+inline void Metric::clear_value() {
+  _impl_.value_ = 0;
+}
+inline double Metric::_internal_value() const {
+  return _impl_.value_;
+}
+inline double Metric::value() const {
+  // @@protoc_insertion_point(field_get:leader.Metric.value)
+  return _internal_value();
+}
+inline void Metric::_internal_set_value(double value) {
+  
+  _impl_.value_ = value;
+}
+inline void Metric::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:leader.Metric.value)
+}
+
+// repeated double bucket_bounds = 5;
+inline int Metric::_internal_bucket_bounds_size() const {
+  return _impl_.bucket_bounds_.size();
+}
+inline int Metric::bucket_bounds_size() const {
+  return _internal_bucket_bounds_size();
+}
+inline void Metric::clear_bucket_bounds() {
+  _impl_.bucket_bounds_.Clear();
+}
+inline double Metric::_internal_bucket_bounds(int index) const {
+  return _impl_.bucket_bounds_.Get(index);
+}
+inline double Metric::bucket_bounds(int index) const {
+  // @@protoc_insertion_point(field_get:leader.Metric.bucket_bounds)
+  return _internal_bucket_bounds(index);
+}
+inline void Metric::set_bucket_bounds(int index, double value) {
+  _impl_.bucket_bounds_.Set(index, value);
+  // @@protoc_insertion_point(field_set:leader.Metric.bucket_bounds)
+}
+inline void Metric::_internal_add_bucket_bounds(double value) {
+  _impl_.bucket_bounds_.Add(value);
+}
+inline void Metric::add_bucket_bounds(double value) {
+  _internal_add_bucket_bounds(value);
+  // @@protoc_insertion_point(field_add:leader.Metric.bucket_bounds)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Metric::_internal_bucket_bounds() const {
+  return _impl_.bucket_bounds_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Metric::bucket_bounds() const {
+  // @@protoc_insertion_point(field_list:leader.Metric.bucket_bounds)
+  return _internal_bucket_bounds();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Metric::_internal_mutable_bucket_bounds() {
+  return &_impl_.bucket_bounds_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Metric::mutable_bucket_bounds() {
+  // @@protoc_insertion_point(field_mutable_list:leader.Metric.bucket_bounds)
+  return _internal_mutable_bucket_bounds();
+}
+
+// repeated uint64 bucket_counts = 6;
+inline int Metric::_internal_bucket_counts_size() const {
+  return _impl_.bucket_counts_.size();
+}
+inline int Metric::bucket_counts_size() const {
+  return _internal_bucket_counts_size();
+}
+inline void Metric::clear_bucket_counts() {
+  _impl_.bucket_counts_.Clear();
+}
+inline uint64_t Metric::_internal_bucket_counts(int index) const {
+  return _impl_.bucket_counts_.Get(index);
+}
+inline uint64_t Metric::bucket_counts(int index) const {
+  // @@protoc_insertion_point(field_get:leader.Metric.bucket_counts)
+  return _internal_bucket_counts(index);
+}
+inline void Metric::set_bucket_counts(int index, uint64_t value) {
+  _impl_.bucket_counts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:leader.Metric.bucket_counts)
+}
+inline void Metric::_internal_add_bucket_counts(uint64_t value) {
+  _impl_.bucket_counts_.Add(value);
+}
+inline void Metric::add_bucket_counts(uint64_t value) {
+  _internal_add_bucket_counts(value);
+  // @@protoc_insertion_point(field_add:leader.Metric.bucket_counts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Metric::_internal_bucket_counts() const {
+  return _impl_.bucket_counts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Metric::bucket_counts() const {
+  // @@protoc_insertion_point(field_list:leader.Metric.bucket_counts)
+  return _internal_bucket_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Metric::_internal_mutable_bucket_counts() {
+  return &_impl_.bucket_counts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Metric::mutable_bucket_counts() {
+  // @@protoc_insertion_point(field_mutable_list:leader.Metric.bucket_counts)
+  return _internal_mutable_bucket_counts();
+}
+
+// double sum = 7;
+inline void Metric::clear_sum() {
+  _impl_.sum_ = 0;
+}
+inline double Metric::_internal_sum() const {
+  return _impl_.sum_;
+}
+inline double Metric::sum() const {
+  // @@protoc_insertion_point(field_get:leader.Metric.sum)
+  return _internal_sum();
+}
+inline void Metric::_internal_set_sum(double value) {
+  
+  _impl_.sum_ = value;
+}
+inline void Metric::set_sum(double value) {
+  _internal_set_sum(value);
+  // @@protoc_insertion_point(field_set:leader.Metric.sum)
+}
+
+// uint64 count = 8;
+inline void Metric::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t Metric::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t Metric::count() const {
+  // @@protoc_insertion_point(field_get:leader.Metric.count)
+  return _internal_count();
+}
+inline void Metric::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void Metric::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:leader.Metric.count)
+}
+
+// -------------------------------------------------------------------
+
+// TraceRequest
+
+// bool enable = 1;
+inline void TraceRequest::clear_enable() {
+  _impl_.enable_ = false;
+}
+inline bool TraceRequest::_internal_enable() const {
+  return _impl_.enable_;
+}
+inline bool TraceRequest::enable() const {
+  // @@protoc_insertion_point(field_get:leader.TraceRequest.enable)
+  return _internal_enable();
+}
+inline void TraceRequest::_internal_set_enable(bool value) {
+  
+  _impl_.enable_ = value;
+}
+inline void TraceRequest::set_enable(bool value) {
+  _internal_set_enable(value);
+  // @@protoc_insertion_point(field_set:leader.TraceRequest.enable)
+}
+
+// bool collect = 2;
+inline void TraceRequest::clear_collect() {
+  _impl_.collect_ = false;
+}
+inline bool TraceRequest::_internal_collect() const {
+  return _impl_.collect_;
+}
+inline bool TraceRequest::collect() const {
+  // @@protoc_insertion_point(field_get:leader.TraceRequest.collect)
+  return _internal_collect();
+}
+inline void TraceRequest::_internal_set_collect(bool value) {
+  
+  _impl_.collect_ = value;
+}
+inline void TraceRequest::set_collect(bool value) {
+  _internal_set_collect(value);
+  // @@protoc_insertion_point(field_set:leader.TraceRequest.collect)
+}
+
+// -------------------------------------------------------------------
+
+// TraceReply
+
+// string node_id = 1;
+inline void TraceReply::clear_node_id() {
+  _impl_.node_id_.ClearToEmpty();
+}
+inline const std::string& TraceReply::node_id() const {
+  // @@protoc_insertion_point(field_get:leader.TraceReply.node_id)
+  return _internal_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TraceReply::set_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.TraceReply.node_id)
+}
+inline std::string* TraceReply::mutable_node_id() {
+  std::string* _s = _internal_mutable_node_id();
+  // @@protoc_insertion_point(field_mutable:leader.TraceReply.node_id)
+  return _s;
+}
+inline const std::string& TraceReply::_internal_node_id() const {
+  return _impl_.node_id_.Get();
+}
+inline void TraceReply::_internal_set_node_id(const std::string& value) {
+  
+  _impl_.node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TraceReply::_internal_mutable_node_id() {
+  
+  return _impl_.node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TraceReply::release_node_id() {
+  // @@protoc_insertion_point(field_release:leader.TraceReply.node_id)
+  return _impl_.node_id_.Release();
+}
+inline void TraceReply::set_allocated_node_id(std::string* node_id) {
+  if (node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_id_.SetAllocated(node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_id_.IsDefault()) {
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.TraceReply.node_id)
+}
+
+// string events_json = 2;
+inline void TraceReply::clear_events_json() {
+  _impl_.events_json_.ClearToEmpty();
+}
+inline const std::string& TraceReply::events_json() const {
+  // @@protoc_insertion_point(field_get:leader.TraceReply.events_json)
+  return _internal_events_json();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TraceReply::set_events_json(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.events_json_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:leader.TraceReply.events_json)
+}
+inline std::string* TraceReply::mutable_events_json() {
+  std::string* _s = _internal_mutable_events_json();
+  // @@protoc_insertion_point(field_mutable:leader.TraceReply.events_json)
+  return _s;
+}
+inline const std::string& TraceReply::_internal_events_json() const {
+  return _impl_.events_json_.Get();
+}
+inline void TraceReply::_internal_set_events_json(const std::string& value) {
+  
+  _impl_.events_json_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TraceReply::_internal_mutable_events_json() {
+  
+  return _impl_.events_json_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TraceReply::release_events_json() {
+  // @@protoc_insertion_point(field_release:leader.TraceReply.events_json)
+  return _impl_.events_json_.Release();
+}
+inline void TraceReply::set_allocated_events_json(std::string* events_json) {
+  if (events_json != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.events_json_.SetAllocated(events_json, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.events_json_.IsDefault()) {
+    _impl_.events_json_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:leader.TraceReply.events_json)
+}
+
+// int64 events = 3;
+inline void TraceReply::clear_events() {
+  _impl_.events_ = int64_t{0};
+}
+inline int64_t TraceReply::_internal_events() const {
+  return _impl_.events_;
+}
+inline int64_t TraceReply::events() const {
+  // @@protoc_insertion_point(field_get:leader.TraceReply.events)
+  return _internal_events();
+}
+inline void TraceReply::_internal_set_events(int64_t value) {
+  
+  _impl_.events_ = value;
+}
+inline void TraceReply::set_events(int64_t value) {
+  _internal_set_events(value);
+  // @@protoc_insertion_point(field_set:leader.TraceReply.events)
+}
+
+// int64 dropped = 4;
+inline void TraceReply::clear_dropped() {
+  _impl_.dropped_ = int64_t{0};
+}
+inline int64_t TraceReply::_internal_dropped() const {
+  return _impl_.dropped_;
+}
+inline int64_t TraceReply::dropped() const {
+  // @@protoc_insertion_point(field_get:leader.TraceReply.dropped)
+  return _internal_dropped();
+}
+inline void TraceReply::_internal_set_dropped(int64_t value) {
+  
+  _impl_.dropped_ = value;
+}
+inline void TraceReply::set_dropped(int64_t value) {
+  _internal_set_dropped(value);
+  // @@protoc_insertion_point(field_set:leader.TraceReply.dropped)
 }
 
 #ifdef __GNUC__
@@ -755,6 +4951,26 @@ inline void Ack::set_allocated_message(std::string* message) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -0,0 +1,85 @@
+#include "load_model.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// Assumed until the first task completes
+constexpr double kInitialServiceMs = 100.0;
+constexpr double kNeverDrains = 1e9;
+}
+
+LoadEstimator::LoadEstimator(double time_constant_ms, int servers)
+    : time_constant_ms_(std::max(1.0, time_constant_ms)),
+      servers_(std::max(1, servers)),
+      last_update_(Clock::now()),
+      service_ms_(kInitialServiceMs) {}
+
+void LoadEstimator::RecordArrivals(int n) {
+    arrivals_.fetch_add(n, std::memory_order_relaxed);
+}
+
+void LoadEstimator::RecordCompletion(double service_ms) {
+    completions_.fetch_add(1, std::memory_order_relaxed);
+    service_us_.fetch_add(static_cast<int64_t>(service_ms * 1000.0), std::memory_order_relaxed);
+}
+
+void LoadEstimator::Update(int queue_length) {
+    auto now = Clock::now();
+    double dt_ms = std::chrono::duration<double, std::milli>(now - last_update_).count();
+    if (dt_ms <= 0.0) {
+        return;
+    }
+    last_update_ = now;
+
+    // Irregular update intervals get a matching weight
+    double alpha = 1.0 - std::exp(-dt_ms / time_constant_ms_);
+    auto blend = [alpha](std::atomic<double>& avg, double sample) {
+        double old = avg.load(std::memory_order_relaxed);
+        avg.store(old + alpha * (sample - old), std::memory_order_relaxed);
+    };
+
+    int64_t arrivals = arrivals_.exchange(0, std::memory_order_relaxed);
+    int64_t completions = completions_.exchange(0, std::memory_order_relaxed);
+    int64_t service_us = service_us_.exchange(0, std::memory_order_relaxed);
+
+    blend(arrival_rate_, arrivals * 1000.0 / dt_ms);
+    blend(queue_, queue_length);
+    if (completions > 0) {
+        double mean_ms = service_us / 1000.0 / completions;
+        if (has_service_sample_) {
+            blend(service_ms_, mean_ms);
+        } else {
+            service_ms_.store(mean_ms, std::memory_order_relaxed);
+            has_service_sample_ = true;
+        }
+    }
+}
+
+double LoadEstimator::arrival_rate() const {
+    return arrival_rate_.load(std::memory_order_relaxed);
+}
+
+double LoadEstimator::service_ms() const {
+    return service_ms_.load(std::memory_order_relaxed);
+}
+
+double LoadEstimator::service_rate() const {
+    return servers_ * 1000.0 / std::max(1e-3, service_ms());
+}
+
+double LoadEstimator::smoothed_queue() const {
+    return queue_.load(std::memory_order_relaxed);
+}
+
+double LoadEstimator::ExpectedWaitMs(double queue_length, double horizon_ms) const {
+    double growth = (arrival_rate() - service_rate()) * horizon_ms / 1000.0;
+    return std::max(0.0, queue_length + growth) * service_ms() / servers_;
+}
+
+double LoadEstimator::DrainTimeMs() const {
+    double net = service_rate() - arrival_rate();
+    if (net <= 0.0) {
+        return smoothed_queue() > 0.5 ? kNeverDrains : 0.0;
+    }
+    return smoothed_queue() / net * 1000.0;
+}
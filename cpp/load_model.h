@@ -0,0 +1,53 @@
+#ifndef LOAD_MODEL_H
+#define LOAD_MODEL_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Exponentially weighted moving averages of a node's arrival rate, service
+// time and queue length, and forecasts built on them. Tasks are recorded
+// from any thread with a relaxed atomic add. Update() folds the counts into
+// the averages and is called from a single thread (the heartbeat loop).
+// The node is modelled as one queue feeding `servers` identical workers.
+class LoadEstimator {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Averages forget old samples with this time constant
+    explicit LoadEstimator(double time_constant_ms = 4000.0, int servers = 1);
+
+    void RecordArrivals(int n);
+    void RecordCompletion(double service_ms);
+
+    void Update(int queue_length);
+
+    double arrival_rate() const;    // tasks per second
+    double service_rate() const;    // tasks per second with every worker busy
+    double service_ms() const;      // mean time one worker takes to run one task
+    double smoothed_queue() const;
+
+    // How long a task arriving horizon_ms from now would wait, assuming
+    // queue_length tasks now and the current arrival/service trend
+    double ExpectedWaitMs(double queue_length, double horizon_ms) const;
+
+    // When the smoothed queue will be empty at the current rates, or a very
+    // large value if it is not draining
+    double DrainTimeMs() const;
+
+private:
+    double time_constant_ms_;
+    int servers_;
+    Clock::time_point last_update_;
+    bool has_service_sample_ = false;
+
+    std::atomic<int64_t> arrivals_{0};
+    std::atomic<int64_t> completions_{0};
+    std::atomic<int64_t> service_us_{0};
+
+    std::atomic<double> arrival_rate_{0.0};
+    std::atomic<double> service_ms_;
+    std::atomic<double> queue_{0.0};
+};
+
+#endif // LOAD_MODEL_H
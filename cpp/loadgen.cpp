@@ -0,0 +1,424 @@
+#include "hdr_histogram.h"
+#include "leader.grpc.pb.h"
+#include "task_trace.h"
+#include "utils.h"
+#include "workload.h"
+#include <grpcpp/grpcpp.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Open-loop load generator. Every connection has its own schedule of
+// intended send times, drawn from the workload models in workload.h, and
+// sends with the async stub, so a slow reply never delays the next send. Latency is taken
+// from a task's intended send time, not from when it actually went out, so
+// stalls in the node or in this process show up in the percentiles instead
+// of silently thinning the load (coordinated omission).
+//
+//   ./loadgen peers.txt --rate=2000 --duration_s=10 --connections=16
+//   ./loadgen localhost:50051 --rate=500 --arrival=fixed --mode=batch --batch=32 --flush_us=2000
+//   ./loadgen peers.txt --durations=pareto --burst_on_ms=200 --burst_off_ms=800 --tenants=50
+//
+// With --replay the schedule comes from a task trace instead, such as one
+// a node wrote with --record, played back at --speed times real time:
+//
+//   ./loadgen peers.txt --replay=node1.trace --speed=4
+//
+// A task's latency ends when AssignTask(s) acknowledges it, i.e. when the
+// node has queued or forwarded it, not when it has run.
+
+using Clock = std::chrono::steady_clock;
+
+struct LoadOptions {
+    WorkloadOptions workload;   // rate, arrivals, durations, tenants and seed
+    int duration_s = 0;         // 0: 10 s of synthetic load, or all of a replayed trace
+    int connections = 8;
+    bool batch = false;         // AssignTasks instead of AssignTask
+    int batch_size = 16;
+    int flush_us = 500;         // send a partly filled batch once its oldest task has waited this long
+    int priority = 0;
+    int timeout_ms = 5000;
+    std::string replay_file;    // send this task trace instead of synthetic load
+    double speed = 1.0;         // replay this many times faster than recorded
+};
+
+struct Results {
+    HdrHistogram corrected{60LL * 1000 * 1000, 3};    // us from intended send
+    HdrHistogram uncorrected{60LL * 1000 * 1000, 3};  // us from actual send
+    std::atomic<int64_t> sent{0};
+    std::atomic<int64_t> ok{0};
+    std::atomic<int64_t> in_flight{0};
+    std::atomic<int64_t> max_lag_us{0};  // how far behind schedule sends fell
+    std::atomic<int32_t> next_task_id{0};  // shared by every connection
+    std::mutex errors_mutex;
+    std::map<std::string, int64_t> errors;  // by status message
+    HdrHistogram task_ms{3600LL * 1000, 3};  // duration_ms of the tasks sent
+    std::mutex tenants_mutex;
+    std::vector<int64_t> tenant_tasks;       // tasks sent per tenant
+};
+
+static bool parse_option(const std::string& arg, LoadOptions* options) {
+    size_t eq = arg.find('=');
+    if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+        return false;
+    }
+    std::string name = arg.substr(2, eq - 2);
+    std::string value = arg.substr(eq + 1);
+
+    if (name == "duration_s") {
+        options->duration_s = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "connections") {
+        options->connections = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "mode") {
+        if (value != "unary" && value != "batch") {
+            return false;
+        }
+        options->batch = value == "batch";
+    } else if (name == "batch") {
+        options->batch_size = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "flush_us") {
+        options->flush_us = std::max(0, std::atoi(value.c_str()));
+    } else if (name == "priority") {
+        options->priority = std::atoi(value.c_str());
+    } else if (name == "timeout_ms") {
+        options->timeout_ms = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "replay") {
+        options->replay_file = value;
+    } else if (name == "speed") {
+        double speed = std::atof(value.c_str());
+        if (speed <= 0.0) {
+            return false;
+        }
+        options->speed = speed;
+    } else {
+        return parse_workload_option(arg, &options->workload);
+    }
+    return true;
+}
+
+static void record_done(Results& results, const grpc::Status& s,
+                        const std::vector<Clock::time_point>& intended, Clock::time_point sent) {
+    auto now = Clock::now();
+    if (s.ok()) {
+        for (const auto& start : intended) {
+            results.corrected.Record(std::chrono::duration_cast<std::chrono::microseconds>(now - start).count());
+            results.uncorrected.Record(std::chrono::duration_cast<std::chrono::microseconds>(now - sent).count());
+        }
+        results.ok.fetch_add(static_cast<int64_t>(intended.size()), std::memory_order_relaxed);
+    } else {
+        std::lock_guard<std::mutex> lock(results.errors_mutex);
+        results.errors[s.error_message()] += static_cast<int64_t>(intended.size());
+    }
+    results.in_flight.fetch_sub(static_cast<int64_t>(intended.size()), std::memory_order_relaxed);
+}
+
+// One task call in flight; deletes itself when the reply arrives
+struct UnaryCall {
+    grpc::ClientContext context;
+    leader::Task task;
+    leader::Ack ack;
+    std::vector<Clock::time_point> intended;
+};
+
+struct BatchCall {
+    grpc::ClientContext context;
+    leader::TaskBatch batch;
+    leader::Ack ack;
+    std::vector<Clock::time_point> intended;
+};
+
+// Sends tasks on one connection, each in its own AssignTask or gathered
+// into AssignTasks batches. Used by one thread at a time.
+class Sender {
+public:
+    Sender(leader::NodeService::Stub* stub, const LoadOptions& options, Results& results)
+        : stub_(stub), options_(options), results_(results) {}
+
+    // intended is when the task was due to go out; it is sent now
+    void Send(leader::Task task, Clock::time_point intended) {
+        int64_t lag = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - intended).count();
+        if (lag > results_.max_lag_us.load(std::memory_order_relaxed)) {
+            results_.max_lag_us.store(lag, std::memory_order_relaxed);
+        }
+        results_.sent.fetch_add(1, std::memory_order_relaxed);
+        results_.in_flight.fetch_add(1, std::memory_order_relaxed);
+
+        if (!options_.batch) {
+            auto* call = new UnaryCall;
+            call->task = std::move(task);
+            call->intended.push_back(intended);
+            call->context.set_deadline(std::chrono::system_clock::now() +
+                                       std::chrono::milliseconds(options_.timeout_ms));
+            auto sent = Clock::now();
+            Results& results = results_;
+            stub_->async()->AssignTask(&call->context, &call->task, &call->ack,
+                                       [call, sent, &results](grpc::Status s) {
+                                           record_done(results, s, call->intended, sent);
+                                           delete call;
+                                       });
+            return;
+        }
+        if (!pending_) {
+            pending_ = std::make_unique<BatchCall>();
+            flush_due_ = Clock::now() + std::chrono::microseconds(options_.flush_us);
+        }
+        *pending_->batch.add_tasks() = std::move(task);
+        pending_->intended.push_back(intended);
+        if (pending_->batch.tasks_size() >= options_.batch_size) {
+            Flush();
+        }
+    }
+
+    // When the batch being gathered has to go out however full it is
+    Clock::time_point flush_due() const {
+        return pending_ ? flush_due_ : Clock::time_point::max();
+    }
+
+    // Sends a partly filled batch
+    void Flush() {
+        if (!pending_) {
+            return;
+        }
+        BatchCall* call = pending_.release();
+        call->context.set_deadline(std::chrono::system_clock::now() +
+                                   std::chrono::milliseconds(options_.timeout_ms));
+        auto sent = Clock::now();
+        Results& results = results_;
+        stub_->async()->AssignTasks(&call->context, &call->batch, &call->ack,
+                                    [call, sent, &results](grpc::Status s) {
+                                        record_done(results, s, call->intended, sent);
+                                        delete call;
+                                    });
+    }
+
+private:
+    leader::NodeService::Stub* stub_;
+    const LoadOptions& options_;
+    Results& results_;
+    std::unique_ptr<BatchCall> pending_;
+    Clock::time_point flush_due_;
+};
+
+// Sleeps until t, sending any batch whose flush deadline comes first, so a
+// batch never waits for a send that is a long way off to fill it
+static void sleep_until_flushing(Clock::time_point t, Sender* senders, size_t count) {
+    for (;;) {
+        Clock::time_point due = t;
+        for (size_t i = 0; i < count; ++i) {
+            due = std::min(due, senders[i].flush_due());
+        }
+        std::this_thread::sleep_until(due);
+        if (due == t) {
+            return;
+        }
+        auto now = Clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            if (senders[i].flush_due() <= now) {
+                senders[i].Flush();
+            }
+        }
+    }
+}
+
+// Sends one connection's share of the workload until end
+static void run_connection(leader::NodeService::Stub* stub, const LoadOptions& options, const Workload& workload,
+                           int index, Clock::time_point start, Clock::time_point end, Results& results) {
+    WorkloadStream stream(workload, index, options.connections);
+    auto at = [&](double t_s) {
+        return start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(t_s));
+    };
+
+    Sender sender(stub, options, results);
+    std::vector<int64_t> tenant_tasks(workload.options().tenants);
+    Clock::time_point intended = at(stream.NextArrival());
+    while (intended < end) {
+        sleep_until_flushing(intended, &sender, 1);
+        leader::Task task;
+        task.set_task_id(results.next_task_id.fetch_add(1, std::memory_order_relaxed));
+        task.set_duration_ms(stream.Duration());
+        task.set_priority(options.priority);
+        int tenant = stream.Tenant();
+        if (tenant >= 0) {
+            task.set_tenant(workload.tenant(tenant));
+            if (workload.options().tenant_keys) {
+                task.set_routing_key(task.tenant());
+            }
+            ++tenant_tasks[tenant];
+        }
+        results.task_ms.Record(task.duration_ms());
+        sender.Send(std::move(task), intended);
+        intended = at(stream.NextArrival());
+    }
+    sender.Flush();
+
+    std::lock_guard<std::mutex> lock(results.tenants_mutex);
+    results.tenant_tasks.resize(tenant_tasks.size());
+    for (size_t i = 0; i < tenant_tasks.size(); ++i) {
+        results.tenant_tasks[i] += tenant_tasks[i];
+    }
+}
+
+// Sends a recorded trace, spacing tasks as they arrived divided by
+// options.speed and dealing them over the connections in turn. One thread
+// reads the trace front to back, so it streams however large the file.
+static bool run_replay(TaskTraceReader& reader, std::vector<std::unique_ptr<leader::NodeService::Stub>>& stubs,
+                       const LoadOptions& options, Clock::time_point start, Clock::time_point end,
+                       Results& results) {
+    std::vector<Sender> senders;
+    for (auto& stub : stubs) {
+        senders.emplace_back(stub.get(), options, results);
+    }
+    TaskTraceRecord record;
+    int64_t first_us = -1;
+    size_t next = 0;
+    while (reader.Next(&record)) {
+        if (first_us < 0) {
+            first_us = record.arrival_us;
+        }
+        auto intended = start + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::micro>((record.arrival_us - first_us) / options.speed));
+        if (intended >= end) {
+            break;
+        }
+        sleep_until_flushing(intended, senders.data(), senders.size());
+        leader::Task task;
+        task.set_task_id(record.task_id);
+        task.set_duration_ms(record.duration_ms);
+        task.set_priority(record.priority);
+        task.set_tenant(reader.tenant(record.tenant));
+        results.task_ms.Record(task.duration_ms());
+        senders[next].Send(std::move(task), intended);
+        next = next + 1 == senders.size() ? 0 : next + 1;
+    }
+    for (auto& sender : senders) {
+        sender.Flush();
+    }
+    return first_us >= 0;
+}
+
+static void print_latency(const char* label, const HdrHistogram& h) {
+    std::printf("%-12s p50 %9.3f  p90 %9.3f  p99 %9.3f  p99.9 %9.3f  max %9.3f ms\n", label,
+                h.ValueAtPercentile(50.0) / 1000.0, h.ValueAtPercentile(90.0) / 1000.0,
+                h.ValueAtPercentile(99.0) / 1000.0, h.ValueAtPercentile(99.9) / 1000.0,
+                h.Max() / 1000.0);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: ./loadgen <address|peers_file> [--rate=tasks_per_s] [--duration_s=n]\n"
+                  << "       [--connections=n] [--arrival=poisson|fixed] [--mode=unary|batch] [--batch=n]\n"
+                  << "       [--flush_us=t] [--task_ms=mean] [--durations=fixed|pareto|lognormal] [--task_max_ms=n]\n"
+                  << "       [--pareto_alpha=a] [--lognormal_sigma=s] [--burst_on_ms=t] [--burst_off_ms=t]\n"
+                  << "       [--diurnal_period_s=t] [--diurnal_amplitude=a] [--tenants=n] [--zipf_s=s]\n"
+                  << "       [--tenant_keys=on|off] [--priority=n] [--timeout_ms=n] [--seed=n]\n"
+                  << "       [--replay=trace_file] [--speed=x]\n";
+        return 1;
+    }
+
+    // A peers file spreads connections over every node; anything else is one address
+    std::vector<std::string> targets = load_peers(argv[1]);
+    if (targets.empty()) {
+        targets.push_back(argv[1]);
+    }
+
+    LoadOptions options;
+    for (int i = 2; i < argc; ++i) {
+        if (!parse_option(argv[i], &options)) {
+            std::cerr << "Unknown option: " << argv[i] << "\n";
+            return 1;
+        }
+    }
+
+    // Separate channel arguments keep gRPC from sharing one TCP connection among them
+    std::vector<std::unique_ptr<leader::NodeService::Stub>> stubs;
+    for (int i = 0; i < options.connections; ++i) {
+        grpc::ChannelArguments args;
+        args.SetInt("loadgen.connection", i);
+        stubs.push_back(leader::NodeService::NewStub(grpc::CreateCustomChannel(
+            targets[i % targets.size()], grpc::InsecureChannelCredentials(), args)));
+    }
+
+    std::string rpc = options.batch ? "AssignTasks x" + std::to_string(options.batch_size) : "AssignTask";
+    Results results;
+    auto start = Clock::now() + std::chrono::milliseconds(100);
+    if (!options.replay_file.empty()) {
+        TaskTraceReader reader;
+        if (!reader.Open(options.replay_file)) {
+            std::cerr << reader.error() << "\n";
+            return 1;
+        }
+        std::printf("replay of %s (%.1f MB) at %gx over %d connections to %zu node(s), %s\n",
+                    options.replay_file.c_str(), reader.size_bytes() / 1e6, options.speed,
+                    options.connections, targets.size(), rpc.c_str());
+        auto end = options.duration_s > 0 ? start + std::chrono::seconds(options.duration_s)
+                                          : Clock::time_point::max();
+        if (!run_replay(reader, stubs, options, start, end, results)) {
+            std::cerr << options.replay_file << " holds no tasks\n";
+            return 1;
+        }
+    } else {
+        int duration_s = options.duration_s > 0 ? options.duration_s : 10;
+        std::printf("%s for %ds over %d connections to %zu node(s), %s\n",
+                    describe_workload(options.workload).c_str(), duration_s,
+                    options.connections, targets.size(), rpc.c_str());
+        Workload workload(options.workload, duration_s);
+        auto end = start + std::chrono::seconds(duration_s);
+        std::vector<std::thread> senders;
+        for (int i = 0; i < options.connections; ++i) {
+            senders.emplace_back(run_connection, stubs[i].get(), std::cref(options), std::cref(workload), i,
+                                 start, end, std::ref(results));
+        }
+        for (auto& sender : senders) {
+            sender.join();
+        }
+    }
+    // Replies still due; every call carries a deadline, so this ends
+    while (results.in_flight.load() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    double elapsed_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+    int64_t errors = 0;
+    for (const auto& [message, count] : results.errors) {
+        errors += count;
+    }
+    std::printf("sent %lld  ok %lld  errors %lld  throughput %.1f tasks/s  max send lag %.3f ms\n",
+                static_cast<long long>(results.sent.load()), static_cast<long long>(results.ok.load()),
+                static_cast<long long>(errors), results.ok.load() / elapsed_s,
+                results.max_lag_us.load() / 1000.0);
+    print_latency("corrected", results.corrected);
+    print_latency("uncorrected", results.uncorrected);
+    const HdrHistogram& task_ms = results.task_ms;
+    std::printf("%-12s p50 %9lld  p90 %9lld  p99 %9lld  p99.9 %9lld  max %9lld ms, mean %.1f\n", "task_ms",
+                static_cast<long long>(task_ms.ValueAtPercentile(50.0)),
+                static_cast<long long>(task_ms.ValueAtPercentile(90.0)),
+                static_cast<long long>(task_ms.ValueAtPercentile(99.0)),
+                static_cast<long long>(task_ms.ValueAtPercentile(99.9)),
+                static_cast<long long>(task_ms.Max()), task_ms.Mean());
+    if (!results.tenant_tasks.empty()) {
+        std::vector<int64_t> counts = results.tenant_tasks;
+        std::sort(counts.rbegin(), counts.rend());
+        int64_t total = std::max<int64_t>(1, results.sent.load());
+        int64_t top = 0;
+        size_t top_n = std::max<size_t>(1, counts.size() / 10);
+        for (size_t i = 0; i < top_n; ++i) {
+            top += counts[i];
+        }
+        std::printf("%-12s busiest %.1f%%  top %zu %.1f%%  of %zu tenants\n", "tenants",
+                    100.0 * counts[0] / total, top_n, 100.0 * top / total, counts.size());
+    }
+    for (const auto& [message, count] : results.errors) {
+        std::printf("  %lld x %s\n", static_cast<long long>(count), message.c_str());
+    }
+    return errors > 0 ? 2 : 0;
+}
@@ -0,0 +1,69 @@
+#ifndef LOCAL_CLUSTER_H
+#define LOCAL_CLUSTER_H
+
+#include "node_server.h"
+#include "leader.grpc.pb.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// A cluster of NodeServiceImpl nodes in one process, each on its own
+// 127.0.0.1 port picked by the OS, all peers of each other. Nodes can be
+// killed and restarted on the same address while the rest keep running.
+// Start, Kill, Restart and StopAll are for one controlling thread; alive(),
+// stub() and Stats() may be called from any thread.
+//
+// The nodes share one process, so whatever a node keeps process-wide is
+// shared too and is not per node here: the trace recorder (a Trace RPC to
+// any node returns every node's threads), the flight recorder (one dump
+// for all of them), the host sampler (every node reports the same host
+// load, so load scores differ only by queue) and the log and lock profile
+// settings that NodeOptions flags set.
+//
+//     LocalCluster cluster(options);
+//     cluster.Start();
+//     cluster.Kill(0);
+//     cluster.Restart(0);
+
+struct ClusterOptions {
+    int nodes = 5;
+    NodeOptions node;  // the same for every node
+    std::vector<std::string> external_peers;  // served elsewhere; every node heartbeats them too
+};
+
+class LocalCluster {
+public:
+    explicit LocalCluster(const ClusterOptions& options);
+    ~LocalCluster();
+    LocalCluster(const LocalCluster&) = delete;
+    LocalCluster& operator=(const LocalCluster&) = delete;
+
+    bool Start();
+    void Kill(int i);
+    bool Restart(int i);
+    void StopAll();
+
+    int size() const { return static_cast<int>(addresses_.size()); }
+    bool alive(int i) const;
+    const std::string& address(int i) const { return addresses_[i]; }
+    const std::vector<std::string>& addresses() const { return addresses_; }
+    int index_of(const std::string& address) const;  // -1 if not a node
+
+    // A client's stub for node i, on a channel of its own
+    leader::NodeService::Stub* stub(int i) { return stubs_[i].get(); }
+    bool Stats(int i, leader::NodeStats* stats, int timeout_ms = 500);
+
+private:
+    ClusterOptions options_;
+    std::vector<std::string> addresses_;
+    std::vector<std::string> peers_;  // addresses_, then options_.external_peers
+    std::vector<std::unique_ptr<NodeServiceImpl>> nodes_;  // null while killed
+    std::vector<std::unique_ptr<leader::NodeService::Stub>> stubs_;
+    mutable std::mutex alive_mutex_;
+    std::vector<bool> alive_;
+
+    bool StartNode(int i);
+};
+
+#endif // LOCAL_CLUSTER_H
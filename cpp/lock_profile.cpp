@@ -0,0 +1,123 @@
+#include "lock_profile.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace lock_profile_internal {
+std::atomic<int> g_sample_every{0};
+}  // namespace lock_profile_internal
+
+namespace {
+
+using lock_profile_internal::g_sample_every;
+
+std::mutex g_sites_mutex;
+const char* g_site_names[kMaxLockSites];
+int g_site_count = 0;
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// One acquisition in every g_sample_every per thread, across all sites
+bool sample_hold(int every) {
+    thread_local uint32_t count = 0;
+    return ++count % static_cast<uint32_t>(every) == 0;
+}
+
+}  // namespace
+
+void set_lock_profile_sample(int n) {
+    g_sample_every.store(std::max(0, n), std::memory_order_relaxed);
+}
+
+int lock_site_index(const char* site) {
+    std::lock_guard<std::mutex> lock(g_sites_mutex);
+    for (int i = 0; i < g_site_count; ++i) {
+        if (std::strcmp(g_site_names[i], site) == 0) {
+            return i;
+        }
+    }
+    if (g_site_count == kMaxLockSites) {
+        return kMaxLockSites - 1;  // overflow shares the last slot
+    }
+    g_site_names[g_site_count] = site;
+    return g_site_count++;
+}
+
+ProfiledMutex::ProfiledMutex(const char* name) : name_(name) {
+    for (auto& site : sites_) {
+        site.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+ProfiledMutex::~ProfiledMutex() {
+    for (auto& site : sites_) {
+        delete site.load(std::memory_order_relaxed);
+    }
+}
+
+// Allocated on a site's first profiled acquisition; racing threads keep the first
+ProfiledMutex::SiteStats& ProfiledMutex::Site(int index) {
+    SiteStats* stats = sites_[index].load(std::memory_order_acquire);
+    if (!stats) {
+        auto* fresh = new SiteStats;
+        if (sites_[index].compare_exchange_strong(stats, fresh, std::memory_order_acq_rel)) {
+            stats = fresh;
+        } else {
+            delete fresh;
+        }
+    }
+    return *stats;
+}
+
+std::vector<LockSiteProfile> ProfiledMutex::Profile() const {
+    std::vector<LockSiteProfile> out;
+    int sites;
+    {
+        std::lock_guard<std::mutex> lock(g_sites_mutex);
+        sites = g_site_count;
+    }
+    for (int i = 0; i < sites; ++i) {
+        const SiteStats* stats = sites_[i].load(std::memory_order_acquire);
+        if (!stats) {
+            continue;
+        }
+        LockSiteProfile p;
+        p.lock = name_;
+        p.site = g_site_names[i];
+        p.acquisitions = stats->acquisitions.Value();
+        p.contended = stats->contended.Value();
+        p.wait_total_ms = stats->wait_ns.load(std::memory_order_relaxed) / 1e6;
+        p.wait_p50_us = stats->wait_hist.ValueAtPercentile(50.0) / 1e3;
+        p.wait_p99_us = stats->wait_hist.ValueAtPercentile(99.0) / 1e3;
+        p.wait_max_us = stats->wait_hist.Max() / 1e3;
+        p.hold_p50_us = stats->hold_hist.ValueAtPercentile(50.0) / 1e3;
+        p.hold_p99_us = stats->hold_hist.ValueAtPercentile(99.0) / 1e3;
+        p.hold_max_us = stats->hold_hist.Max() / 1e3;
+        out.push_back(std::move(p));
+    }
+    return out;
+}
+
+void ProfiledLock::LockProfiled(int site, int every) {
+    stats_ = &mutex_.Site(site);
+    stats_->acquisitions.Inc();
+    if (!mutex_.mutex_.try_lock()) {
+        int64_t start = now_ns();
+        mutex_.mutex_.lock();
+        int64_t waited = now_ns() - start;
+        stats_->contended.Inc();
+        stats_->wait_ns.fetch_add(waited, std::memory_order_relaxed);
+        stats_->wait_hist.Record(waited);
+    }
+    if (sample_hold(every)) {
+        held_since_ns_ = now_ns();
+    }
+}
+
+// Measured to just after the unlock; recording outside keeps the hold short
+void ProfiledLock::RecordHold() {
+    stats_->hold_hist.Record(now_ns() - held_since_ns_);
+}
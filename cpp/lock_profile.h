@@ -0,0 +1,125 @@
+#ifndef LOCK_PROFILE_H
+#define LOCK_PROFILE_H
+
+#include "hdr_histogram.h"
+#include "metrics.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Lock contention by call site. A ProfiledMutex is a std::mutex that, when
+// taken through PROFILED_LOCK, counts acquisitions and contended
+// acquisitions per call site, times every contended wait, and times how
+// long one acquisition in every set_lock_profile_sample() is held. An
+// uncontended acquisition costs a try_lock and a sharded counter add; with
+// profiling off, a relaxed load and a plain lock.
+//
+//     PROFILED_LOCK(lock, queue_mutex_, "ProcessTasks");
+
+constexpr int kMaxLockSites = 32;  // distinct site names in the process
+
+// 0 turns profiling off, the default; n > 0 turns it on and times the hold
+// of one acquisition in n
+constexpr int kDefaultLockProfileSample = 64;  // what a bare --lock_profile sets
+void set_lock_profile_sample(int n);
+
+namespace lock_profile_internal {
+extern std::atomic<int> g_sample_every;
+}  // namespace lock_profile_internal
+
+// Index for a call site name, the same for every mutex; the name must outlive the process
+int lock_site_index(const char* site);
+
+struct LockSiteProfile {
+    std::string lock;
+    std::string site;
+    int64_t acquisitions = 0;
+    int64_t contended = 0;
+    double wait_total_ms = 0.0;
+    double wait_p50_us = 0.0;   // over contended acquisitions
+    double wait_p99_us = 0.0;
+    double wait_max_us = 0.0;
+    double hold_p50_us = 0.0;   // over sampled acquisitions
+    double hold_p99_us = 0.0;
+    double hold_max_us = 0.0;
+};
+
+class ProfiledMutex {
+public:
+    explicit ProfiledMutex(const char* name);
+    ~ProfiledMutex();
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    // BasicLockable, unprofiled, for std::lock_guard and friends
+    void lock() { mutex_.lock(); }
+    void unlock() { mutex_.unlock(); }
+    bool try_lock() { return mutex_.try_lock(); }
+
+    const char* name() const { return name_; }
+
+    // One entry per site that has taken this mutex while profiling
+    std::vector<LockSiteProfile> Profile() const;
+
+private:
+    friend class ProfiledLock;
+
+    struct SiteStats {
+        Counter acquisitions;
+        Counter contended;
+        std::atomic<int64_t> wait_ns{0};
+        HdrHistogram wait_hist{10LL * 1000 * 1000 * 1000, 2};  // ns, up to 10 s
+        HdrHistogram hold_hist{10LL * 1000 * 1000 * 1000, 2};
+    };
+
+    std::mutex mutex_;
+    const char* name_;
+    std::atomic<SiteStats*> sites_[kMaxLockSites];
+
+    SiteStats& Site(int index);
+};
+
+// Scoped lock that records into the mutex's stats for one call site
+class ProfiledLock {
+public:
+    ProfiledLock(ProfiledMutex& mutex, int site) : mutex_(mutex) {
+        int every = lock_profile_internal::g_sample_every.load(std::memory_order_relaxed);
+        if (every == 0) {
+            mutex_.mutex_.lock();
+        } else {
+            LockProfiled(site, every);
+        }
+    }
+    ~ProfiledLock() {
+        if (owns_) {
+            unlock();
+        }
+    }
+    ProfiledLock(const ProfiledLock&) = delete;
+    ProfiledLock& operator=(const ProfiledLock&) = delete;
+
+    void unlock() {
+        owns_ = false;
+        mutex_.mutex_.unlock();
+        if (held_since_ns_ != 0) {
+            RecordHold();
+        }
+    }
+
+private:
+    ProfiledMutex& mutex_;
+    ProfiledMutex::SiteStats* stats_ = nullptr;
+    int64_t held_since_ns_ = 0;  // nonzero when this hold is sampled
+    bool owns_ = true;
+
+    void LockProfiled(int site, int every);
+    void RecordHold();
+};
+
+#define PROFILED_LOCK(var, mutex, site)                              \
+    static const int var##_site = lock_site_index(site);             \
+    ProfiledLock var(mutex, var##_site)
+
+#endif // LOCK_PROFILE_H
@@ -0,0 +1,223 @@
+#include "log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace log_internal {
+std::atomic<int> g_level{static_cast<int>(LogLevel::INFO)};
+std::atomic<int> g_sample_every{1};
+}  // namespace log_internal
+
+namespace {
+
+using log_internal::Record;
+
+constexpr uint64_t kRingSize = 512;  // records per thread, a power of two
+constexpr int kIdleSleepMs = 1;
+
+// Single producer (the owning thread), single consumer (the writer)
+struct Ring {
+    alignas(64) std::atomic<uint64_t> head{0};  // next record the writer reads
+    alignas(64) std::atomic<uint64_t> tail{0};  // next slot the owner fills
+    std::atomic<bool> retired{false};           // owner thread has exited
+    Record records[kRingSize];
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+};
+
+// Never destroyed: the writer thread outlives static destruction
+Registry& registry() {
+    static Registry* r = new Registry;
+    return *r;
+}
+
+std::atomic<uint64_t> g_dropped{0};
+std::atomic<uint64_t> g_writer_cycles{0};  // completed passes over the rings, for log_flush
+
+// Owned by each logging thread; retires the ring when the thread exits
+struct RingOwner {
+    std::shared_ptr<Ring> ring;
+    ~RingOwner() {
+        if (ring) {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local RingOwner t_ring;
+
+void append_arg(const Record& r, const log_internal::Arg& a, std::string& out) {
+    char buf[32];
+    switch (a.type) {
+        case log_internal::ArgType::INT:
+            out += std::to_string(a.i);
+            break;
+        case log_internal::ArgType::DOUBLE:
+            std::snprintf(buf, sizeof(buf), "%g", a.d);
+            out += buf;
+            break;
+        case log_internal::ArgType::TEXT:
+            out.append(r.text + a.offset, a.length);
+            break;
+    }
+}
+
+void format(const Record& r, std::string& out) {
+    out += '[';
+    out += r.tag;
+    out += "] ";
+    int next = 0;
+    for (const char* p = r.format; *p; ++p) {
+        if (p[0] == '{' && p[1] == '}' && next < r.nargs) {
+            append_arg(r, r.args[next++], out);
+            ++p;
+        } else {
+            out += *p;
+        }
+    }
+    out += '\n';
+}
+
+void writer_loop() {
+    std::vector<std::shared_ptr<Ring>> rings;
+    std::vector<Record> batch;
+    std::string out, err;
+    uint64_t reported_drops = 0;
+
+    for (;; g_writer_cycles.fetch_add(1, std::memory_order_release)) {
+        {
+            std::lock_guard<std::mutex> lock(registry().mutex);
+            auto& all = registry().rings;
+            // A retired ring is dropped once everything its thread wrote is read
+            all.erase(std::remove_if(all.begin(), all.end(), [](const std::shared_ptr<Ring>& ring) {
+                return ring->retired.load(std::memory_order_acquire) &&
+                       ring->head.load(std::memory_order_relaxed) ==
+                           ring->tail.load(std::memory_order_acquire);
+            }), all.end());
+            rings = all;
+        }
+
+        batch.clear();
+        for (const auto& ring : rings) {
+            uint64_t head = ring->head.load(std::memory_order_relaxed);
+            uint64_t tail = ring->tail.load(std::memory_order_acquire);
+            for (; head != tail; ++head) {
+                batch.push_back(ring->records[head & (kRingSize - 1)]);
+            }
+            ring->head.store(tail, std::memory_order_release);
+        }
+
+        uint64_t dropped = g_dropped.load(std::memory_order_relaxed);
+        if (batch.empty() && dropped == reported_drops) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(kIdleSleepMs));
+            continue;
+        }
+
+        // Rings are drained one after another; put threads back in time order
+        std::stable_sort(batch.begin(), batch.end(), [](const Record& a, const Record& b) {
+            return a.time_ns < b.time_ns;
+        });
+        out.clear();
+        err.clear();
+        for (const Record& r : batch) {
+            format(r, r.level >= LogLevel::WARN ? err : out);
+        }
+        if (dropped != reported_drops) {
+            err += "[LOG] Dropped " + std::to_string(dropped - reported_drops) +
+                   " records, log rings were full\n";
+            reported_drops = dropped;
+        }
+        if (!out.empty()) {
+            std::fwrite(out.data(), 1, out.size(), stdout);
+            std::fflush(stdout);
+        }
+        if (!err.empty()) {
+            std::fwrite(err.data(), 1, err.size(), stderr);
+        }
+    }
+}
+
+Ring& this_thread_ring() {
+    if (!t_ring.ring) {
+        static std::once_flag writer_started;
+        std::call_once(writer_started, [] { std::thread(writer_loop).detach(); });
+
+        t_ring.ring = std::make_shared<Ring>();
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        registry().rings.push_back(t_ring.ring);
+    }
+    return *t_ring.ring;
+}
+
+}  // namespace
+
+namespace log_internal {
+
+void submit(Record& r) {
+    Ring& ring = this_thread_ring();
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (tail - ring.head.load(std::memory_order_acquire) >= kRingSize) {
+        g_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    r.time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    ring.records[tail & (kRingSize - 1)] = r;
+    ring.tail.store(tail + 1, std::memory_order_release);
+}
+
+}  // namespace log_internal
+
+bool parse_log_level(const std::string& name, LogLevel* level) {
+    if (name == "debug") {
+        *level = LogLevel::DEBUG;
+    } else if (name == "info") {
+        *level = LogLevel::INFO;
+    } else if (name == "warn") {
+        *level = LogLevel::WARN;
+    } else if (name == "error") {
+        *level = LogLevel::ERROR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void set_log_level(LogLevel level) {
+    log_internal::g_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+void set_log_sample_every(int n) {
+    log_internal::g_sample_every.store(std::max(1, n), std::memory_order_relaxed);
+}
+
+void log_flush() {
+    std::vector<std::pair<std::shared_ptr<Ring>, uint64_t>> pending;
+    {
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        for (const auto& ring : registry().rings) {
+            pending.emplace_back(ring, ring->tail.load(std::memory_order_acquire));
+        }
+    }
+    // The writer starts with the first ring; with none, nothing was logged
+    if (pending.empty()) {
+        return;
+    }
+    for (const auto& [ring, tail] : pending) {
+        while (ring->head.load(std::memory_order_acquire) < tail) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(kIdleSleepMs));
+        }
+    }
+    // Records are read before they are written out; wait for that pass to end
+    uint64_t cycle = g_writer_cycles.load(std::memory_order_acquire);
+    while (g_writer_cycles.load(std::memory_order_acquire) == cycle) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(kIdleSleepMs));
+    }
+}
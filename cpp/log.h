@@ -0,0 +1,143 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+// Asynchronous logging. The LOG_* macros copy their arguments into a fixed
+// size binary record on a per-thread lock-free ring; one background thread
+// formats and writes the records, so the calling thread never formats text
+// or takes a stream lock. A record that finds its ring full is dropped and
+// counted instead of blocking.
+//
+// The tag and format must be string literals. Each "{}" in the format is
+// replaced by the next argument, e.g.
+//     LOG_INFO("STEAL", "Took {} tasks from {}", n, victim);
+// prints "[STEAL] Took 3 tasks from localhost:50052".
+
+enum class LogLevel : uint8_t {
+    DEBUG,
+    INFO,
+    WARN,   // WARN and ERROR go to stderr, the rest to stdout
+    ERROR
+};
+
+bool parse_log_level(const std::string& name, LogLevel* level);
+void set_log_level(LogLevel level);
+
+// LOG_SAMPLED call sites keep one record in every n
+void set_log_sample_every(int n);
+
+// Waits until everything logged before the call has been written
+void log_flush();
+
+namespace log_internal {
+
+constexpr int kMaxArgs = 4;
+constexpr size_t kTextBytes = 64;  // shared by all string arguments, truncated beyond
+
+enum class ArgType : uint8_t { INT, DOUBLE, TEXT };
+
+struct Arg {
+    ArgType type;
+    uint8_t offset;  // TEXT: where in Record::text
+    uint8_t length;
+    union {
+        int64_t i;
+        double d;
+    };
+};
+
+struct Record {
+    int64_t time_ns;
+    const char* tag;
+    const char* format;
+    LogLevel level;
+    uint8_t nargs;
+    uint8_t text_used;
+    Arg args[kMaxArgs];
+    char text[kTextBytes];
+};
+
+extern std::atomic<int> g_level;
+extern std::atomic<int> g_sample_every;
+
+inline bool enabled(LogLevel level) {
+    return static_cast<int>(level) >= g_level.load(std::memory_order_relaxed);
+}
+
+inline bool sample(uint64_t& site_count) {
+    int every = g_sample_every.load(std::memory_order_relaxed);
+    return every <= 1 || site_count++ % every == 0;
+}
+
+inline void encode_text(Record& r, const char* s, size_t n) {
+    Arg& a = r.args[r.nargs++];
+    a.type = ArgType::TEXT;
+    a.offset = r.text_used;
+    a.length = static_cast<uint8_t>(std::min(n, kTextBytes - r.text_used));
+    std::memcpy(r.text + a.offset, s, a.length);
+    r.text_used += a.length;
+}
+
+inline void encode(Record& r, const char* s) { encode_text(r, s, std::strlen(s)); }
+inline void encode(Record& r, const std::string& s) { encode_text(r, s.data(), s.size()); }
+
+template <typename T>
+std::enable_if_t<std::is_arithmetic_v<T>> encode(Record& r, T v) {
+    Arg& a = r.args[r.nargs++];
+    if constexpr (std::is_floating_point_v<T>) {
+        a.type = ArgType::DOUBLE;
+        a.d = v;
+    } else {
+        a.type = ArgType::INT;
+        a.i = static_cast<int64_t>(v);
+    }
+}
+
+void submit(Record& r);
+
+template <typename... Args>
+void write(LogLevel level, const char* tag, const char* format, const Args&... args) {
+    static_assert(sizeof...(Args) <= kMaxArgs, "too many log arguments");
+    Record r;
+    r.level = level;
+    r.tag = tag;
+    r.format = format;
+    r.nargs = 0;
+    r.text_used = 0;
+    (encode(r, args), ...);
+    submit(r);
+}
+
+}  // namespace log_internal
+
+#define LOG_AT(level, tag, ...)                                      \
+    do {                                                             \
+        if (log_internal::enabled(level)) {                          \
+            log_internal::write(level, tag, __VA_ARGS__);            \
+        }                                                            \
+    } while (0)
+
+#define LOG_DEBUG(tag, ...) LOG_AT(LogLevel::DEBUG, tag, __VA_ARGS__)
+#define LOG_INFO(tag, ...) LOG_AT(LogLevel::INFO, tag, __VA_ARGS__)
+#define LOG_WARN(tag, ...) LOG_AT(LogLevel::WARN, tag, __VA_ARGS__)
+#define LOG_ERROR(tag, ...) LOG_AT(LogLevel::ERROR, tag, __VA_ARGS__)
+
+// For per-task and per-heartbeat lines: keeps one call in every
+// set_log_sample_every() at this site, counted per thread so the hot path
+// shares no cache line with other threads
+#define LOG_SAMPLED(level, tag, ...)                                 \
+    do {                                                             \
+        static thread_local uint64_t log_site_count = 0;             \
+        if (log_internal::enabled(level) &&                          \
+            log_internal::sample(log_site_count)) {                  \
+            log_internal::write(level, tag, __VA_ARGS__);            \
+        }                                                            \
+    } while (0)
+
+#endif // LOG_H
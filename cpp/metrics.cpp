@@ -0,0 +1,205 @@
+#include "metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+std::atomic<int> g_next_shard{0};
+
+void add_double(std::atomic<double>& target, double v) {
+    double old = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(old, old + v, std::memory_order_relaxed)) {
+    }
+}
+
+std::string format_value(double v) {
+    if (std::isinf(v)) {
+        return v > 0 ? "+Inf" : "-Inf";
+    }
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.15g", v);
+    return buf;
+}
+
+const char* type_name(MetricType type) {
+    switch (type) {
+        case MetricType::COUNTER:   return "counter";
+        case MetricType::GAUGE:     return "gauge";
+        case MetricType::HISTOGRAM: return "histogram";
+    }
+    return "untyped";
+}
+
+// name{labels,extra} with whichever parts are present
+std::string series(const std::string& name, const std::string& labels,
+                   const std::string& extra = "") {
+    std::string s = name;
+    if (!labels.empty() || !extra.empty()) {
+        s += '{';
+        s += labels;
+        if (!labels.empty() && !extra.empty()) {
+            s += ',';
+        }
+        s += extra;
+        s += '}';
+    }
+    return s;
+}
+
+}  // namespace
+
+int metric_shard() {
+    thread_local int shard = g_next_shard.fetch_add(1, std::memory_order_relaxed) % kMetricShards;
+    return shard;
+}
+
+int64_t Counter::Value() const {
+    int64_t total = 0;
+    for (const Cell& cell : cells_) {
+        total += cell.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void Gauge::Add(double v) {
+    add_double(value_, v);
+}
+
+Histogram::Histogram(std::vector<double> bounds) : bounds_(std::move(bounds)) {
+    std::sort(bounds_.begin(), bounds_.end());
+    constexpr size_t kPerLine = 64 / sizeof(std::atomic<uint64_t>);
+    stride_ = (bounds_.size() + 1 + kPerLine - 1) / kPerLine * kPerLine;
+    counts_.reset(new std::atomic<uint64_t>[stride_ * kMetricShards]);
+    for (size_t i = 0; i < stride_ * kMetricShards; ++i) {
+        counts_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Histogram::Observe(double v) {
+    size_t bucket = std::lower_bound(bounds_.begin(), bounds_.end(), v) - bounds_.begin();
+    int shard = metric_shard();
+    counts_[shard * stride_ + bucket].fetch_add(1, std::memory_order_relaxed);
+    add_double(sums_[shard].value, v);
+}
+
+std::vector<uint64_t> Histogram::Counts() const {
+    std::vector<uint64_t> counts(bounds_.size() + 1, 0);
+    for (int shard = 0; shard < kMetricShards; ++shard) {
+        for (size_t b = 0; b < counts.size(); ++b) {
+            counts[b] += counts_[shard * stride_ + b].load(std::memory_order_relaxed);
+        }
+    }
+    return counts;
+}
+
+double Histogram::Sum() const {
+    double total = 0.0;
+    for (const SumCell& cell : sums_) {
+        total += cell.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+std::vector<double> exponential_buckets(double start, double factor, int count) {
+    std::vector<double> bounds;
+    for (int i = 0; i < count; ++i, start *= factor) {
+        bounds.push_back(start);
+    }
+    return bounds;
+}
+
+MetricsRegistry::Entry& MetricsRegistry::AddEntry(const std::string& name, const std::string& help,
+                                                  const std::string& labels, MetricType type) {
+    entries_.emplace_back();
+    Entry& e = entries_.back();
+    e.name = name;
+    e.labels = labels;
+    e.help = help;
+    e.type = type;
+    return e;
+}
+
+Counter& MetricsRegistry::AddCounter(const std::string& name, const std::string& help,
+                                     const std::string& labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& e = AddEntry(name, help, labels, MetricType::COUNTER);
+    e.counter = std::make_unique<Counter>();
+    return *e.counter;
+}
+
+Gauge& MetricsRegistry::AddGauge(const std::string& name, const std::string& help,
+                                 const std::string& labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& e = AddEntry(name, help, labels, MetricType::GAUGE);
+    e.gauge = std::make_unique<Gauge>();
+    return *e.gauge;
+}
+
+void MetricsRegistry::AddGaugeFn(const std::string& name, const std::string& help,
+                                 std::function<double()> fn, const std::string& labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    AddEntry(name, help, labels, MetricType::GAUGE).gauge_fn = std::move(fn);
+}
+
+Histogram& MetricsRegistry::AddHistogram(const std::string& name, const std::string& help,
+                                         std::vector<double> bounds, const std::string& labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& e = AddEntry(name, help, labels, MetricType::HISTOGRAM);
+    e.histogram = std::make_unique<Histogram>(std::move(bounds));
+    return *e.histogram;
+}
+
+std::vector<MetricSnapshot> MetricsRegistry::Snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<MetricSnapshot> out;
+    for (const Entry& e : entries_) {
+        MetricSnapshot s;
+        s.name = e.name;
+        s.labels = e.labels;
+        s.help = e.help;
+        s.type = e.type;
+        if (e.counter) {
+            s.value = static_cast<double>(e.counter->Value());
+        } else if (e.gauge) {
+            s.value = e.gauge->Value();
+        } else if (e.gauge_fn) {
+            s.value = e.gauge_fn();
+        } else if (e.histogram) {
+            s.bounds = e.histogram->bounds();
+            s.counts = e.histogram->Counts();
+            s.sum = e.histogram->Sum();
+            for (uint64_t c : s.counts) {
+                s.count += c;
+            }
+        }
+        out.push_back(std::move(s));
+    }
+    return out;
+}
+
+std::string MetricsRegistry::PrometheusText() const {
+    std::string out;
+    std::string last_name;
+    for (const MetricSnapshot& s : Snapshot()) {
+        if (s.name != last_name) {
+            out += "# HELP " + s.name + " " + s.help + "\n";
+            out += "# TYPE " + s.name + " " + type_name(s.type) + "\n";
+            last_name = s.name;
+        }
+        if (s.type != MetricType::HISTOGRAM) {
+            out += series(s.name, s.labels) + " " + format_value(s.value) + "\n";
+            continue;
+        }
+        uint64_t cumulative = 0;
+        for (size_t b = 0; b < s.counts.size(); ++b) {
+            cumulative += s.counts[b];
+            double le = b < s.bounds.size() ? s.bounds[b] : INFINITY;
+            out += series(s.name + "_bucket", s.labels, "le=\"" + format_value(le) + "\"") +
+                   " " + std::to_string(cumulative) + "\n";
+        }
+        out += series(s.name + "_sum", s.labels) + " " + format_value(s.sum) + "\n";
+        out += series(s.name + "_count", s.labels) + " " + std::to_string(s.count) + "\n";
+    }
+    return out;
+}
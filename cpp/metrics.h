@@ -0,0 +1,127 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Counters, gauges and histograms that are cheap to update from any thread.
+// Counters and histograms are sharded: each thread adds to its own
+// cache-line-sized cell, and cells are only summed when someone reads.
+// Updating a metric never takes a lock; only registering metrics and
+// reading the registry do.
+
+constexpr int kMetricShards = 16;
+
+// Which shard the calling thread writes to
+int metric_shard();
+
+class Counter {
+public:
+    void Inc(int64_t n = 1) {
+        cells_[metric_shard()].value.fetch_add(n, std::memory_order_relaxed);
+    }
+    int64_t Value() const;
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<int64_t> value{0};
+    };
+    Cell cells_[kMetricShards];
+};
+
+class Gauge {
+public:
+    void Set(double v) { value_.store(v, std::memory_order_relaxed); }
+    void Add(double v);
+    double Value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<double> value_{0.0};
+};
+
+// Fixed buckets: bounds are upper bounds, in increasing order, and a final
+// +Inf bucket catches the rest.
+class Histogram {
+public:
+    explicit Histogram(std::vector<double> bounds);
+
+    void Observe(double v);
+
+    const std::vector<double>& bounds() const { return bounds_; }
+    // Per-bucket (not cumulative) counts, bounds().size() + 1 of them
+    std::vector<uint64_t> Counts() const;
+    double Sum() const;
+
+private:
+    std::vector<double> bounds_;
+    size_t stride_;  // atomics per shard, padded to a cache line
+    std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+    struct alignas(64) SumCell {
+        std::atomic<double> value{0.0};
+    };
+    SumCell sums_[kMetricShards];
+};
+
+// count bounds starting at start, each factor times the last
+std::vector<double> exponential_buckets(double start, double factor, int count);
+
+enum class MetricType { COUNTER, GAUGE, HISTOGRAM };
+
+struct MetricSnapshot {
+    std::string name;
+    std::string labels;  // e.g. lock="queue", or empty
+    std::string help;
+    MetricType type;
+    double value = 0.0;              // counters and gauges
+    std::vector<double> bounds;      // histograms
+    std::vector<uint64_t> counts;    // per bucket, last is +Inf
+    double sum = 0.0;
+    uint64_t count = 0;
+};
+
+// Owns a node's metrics. Register everything up front; the returned
+// references stay valid for the registry's lifetime. Metrics that share a
+// name (differing only in labels) should be registered one after another.
+class MetricsRegistry {
+public:
+    Counter& AddCounter(const std::string& name, const std::string& help,
+                        const std::string& labels = "");
+    Gauge& AddGauge(const std::string& name, const std::string& help,
+                    const std::string& labels = "");
+    // Evaluated only when the registry is read, so it costs nothing to keep
+    void AddGaugeFn(const std::string& name, const std::string& help,
+                    std::function<double()> fn, const std::string& labels = "");
+    Histogram& AddHistogram(const std::string& name, const std::string& help,
+                            std::vector<double> bounds, const std::string& labels = "");
+
+    std::vector<MetricSnapshot> Snapshot() const;
+
+    // Prometheus text exposition format, version 0.0.4
+    std::string PrometheusText() const;
+
+private:
+    struct Entry {
+        std::string name;
+        std::string labels;
+        std::string help;
+        MetricType type;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::function<double()> gauge_fn;
+        std::unique_ptr<Histogram> histogram;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+
+    // Caller holds mutex_
+    Entry& AddEntry(const std::string& name, const std::string& help,
+                    const std::string& labels, MetricType type);
+};
+
+#endif // METRICS_H
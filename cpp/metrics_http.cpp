@@ -0,0 +1,118 @@
+#include "metrics_http.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0  // macOS: SO_NOSIGPIPE is set on each connection instead
+#endif
+
+namespace {
+
+void write_all(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return;
+        }
+        sent += static_cast<size_t>(n);
+    }
+}
+
+}  // namespace
+
+MetricsHttpServer::~MetricsHttpServer() {
+    Stop();
+}
+
+bool MetricsHttpServer::Start(int port, std::function<std::string()> render) {
+    Stop();
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0) {
+        return false;
+    }
+    int on = 1;
+    ::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        ::listen(listener, 16) < 0 || ::pipe(wake_) < 0) {
+        ::close(listener);
+        return false;
+    }
+
+    listener_ = listener;
+    thread_ = std::thread(&MetricsHttpServer::Serve, this, std::move(render));
+    return true;
+}
+
+void MetricsHttpServer::Stop() {
+    if (listener_ < 0) {
+        return;
+    }
+    char stop = 0;
+    while (::write(wake_[1], &stop, 1) < 0 && errno == EINTR) {
+    }
+    thread_.join();
+    ::close(listener_);
+    ::close(wake_[0]);
+    ::close(wake_[1]);
+    listener_ = -1;
+    wake_[0] = wake_[1] = -1;
+}
+
+void MetricsHttpServer::Serve(std::function<std::string()> render) {
+    while (true) {
+        pollfd fds[2] = {{listener_, POLLIN, 0}, {wake_[0], POLLIN, 0}};
+        if (::poll(fds, 2, -1) < 0) {
+            continue;
+        }
+        if (fds[1].revents != 0) {
+            return;
+        }
+        int fd = ::accept(listener_, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+        // Don't let a client that never sends its request hold up the next scrape
+        timeval timeout{1, 0};
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+        int on = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+
+        // Read the request head; only the method matters
+        std::string request;
+        char buf[1024];
+        while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192) {
+            ssize_t n = ::recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0) {
+                break;
+            }
+            request.append(buf, static_cast<size_t>(n));
+        }
+
+        std::string response;
+        if (request.rfind("GET ", 0) == 0) {
+            std::string body = render();
+            response = "HTTP/1.1 200 OK\r\n"
+                       "Content-Type: text/plain; version=0.0.4\r\n"
+                       "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                       "Connection: close\r\n\r\n" + body;
+        } else {
+            response = "HTTP/1.1 405 Method Not Allowed\r\n"
+                       "Content-Length: 0\r\nConnection: close\r\n\r\n";
+        }
+        write_all(fd, response);
+        ::close(fd);
+    }
+}
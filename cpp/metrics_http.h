@@ -0,0 +1,31 @@
+#ifndef METRICS_HTTP_H
+#define METRICS_HTTP_H
+
+#include <functional>
+#include <string>
+#include <thread>
+
+// Serves render() as text/plain on every GET, for Prometheus to scrape.
+// Listens on 127.0.0.1:port from a thread of its own and handles one
+// connection at a time; scrapes are rare and small. Stop(), or the
+// destructor, closes the port and joins the thread, so render may use
+// whatever owns the server.
+class MetricsHttpServer {
+public:
+    MetricsHttpServer() = default;
+    ~MetricsHttpServer();
+    MetricsHttpServer(const MetricsHttpServer&) = delete;
+    MetricsHttpServer& operator=(const MetricsHttpServer&) = delete;
+
+    bool Start(int port, std::function<std::string()> render);  // false if the port cannot be bound
+    void Stop();
+
+private:
+    int listener_ = -1;
+    int wake_[2] = {-1, -1};  // written by Stop() to end the serve loop
+    std::thread thread_;
+
+    void Serve(std::function<std::string()> render);
+};
+
+#endif // METRICS_HTTP_H
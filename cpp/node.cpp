@@ -1,24 +1,32 @@
 #include "node_server.h"
+#include "flight_recorder.h"
+#include "log.h"
+#include "utils.h"
+#include <algorithm>
 #include <iostream>
-#include <fstream>
 #include <vector>
 
-// Load peer addresses from a config file (one per line)
-std::vector<std::string> load_peers(const std::string& filename) {
-    std::vector<std::string> peers;
-    std::ifstream file(filename);
-    std::string line;
-    while (std::getline(file, line)) {
-        if (!line.empty()) {
-            peers.push_back(line);
-        }
-    }
-    return peers;
+template <typename ScorePolicy>
+int run_node(const std::string& node_id, const std::vector<std::string>& peers,
+             const NodeOptions& options) {
+    LOG_INFO("INFO", "Scoring policy: {}", ScorePolicy::kName);
+    BasicNodeService<ScorePolicy> server(node_id, options);
+    server.StartHeartbeatLoop(peers);
+    server.Run(node_id);
+    return 0;
 }
 
 int main(int argc, char** argv) {
-    if (argc != 3) {
-        std::cerr << "Usage: ./server <node_id> <peers_file>\n";
+    if (argc < 3) {
+        std::cerr << "Usage: ./server <node_id> <peers_file> [--dispatch=local|greedy|random|p2c] [--choices=d] [--steal_batch=n]\n"
+                  << "       [--virtual_nodes=n] [--affinity_load=c]\n"
+                  << "       [--batch_size=n] [--flush_us=t] [--max_in_flight=k]\n"
+                  << "       [--host_sample_ms=t] [--ewma_ms=t] [--workers=n] [--metrics_port=p]\n"
+                  << "       [--heartbeat_ms=t] [--election_ms=t] [--peer_timeout_ms=t] [--heartbeat_fanout=k]\n"
+                  << "       [--record=trace_file]\n"
+                  << "       [--score=weighted|expected_wait|capacity|slo]\n"
+                  << "       [--log_level=debug|info|warn|error] [--log_sample=n] [--trace=on|off]\n"
+                  << "       [--lock_profile[=n]] [--flight_file=path]\n";
         return 1;
     }
 
@@ -32,10 +40,37 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    // Start the gRPC server and heartbeat loop
-    NodeServiceImpl server(node_id);
-    server.StartHeartbeatLoop(peers);
-    server.Run(node_id);
+    NodeOptions options;
+    std::string score = WeightedSumPolicy::kName;
+    // Where the flight recorder is dumped on SIGUSR1 or a crash
+    std::string flight_file = node_id + ".flight";
+    std::replace(flight_file.begin(), flight_file.end(), ':', '_');
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--score=", 0) == 0) {
+            score = arg.substr(8);
+        } else if (arg.rfind("--flight_file=", 0) == 0) {
+            flight_file = arg.substr(14);
+        } else if (!parse_node_option(arg, &options)) {
+            std::cerr << "Unknown option: " << argv[i] << "\n";
+            return 1;
+        }
+    }
 
-    return 0;
+    if (!flight_recorder_install(flight_file)) {
+        std::cerr << "Could not install the flight recorder for " << flight_file << "\n";
+    }
+
+    // Start the gRPC server and heartbeat loop with the chosen scoring policy
+    if (score == WeightedSumPolicy::kName) {
+        return run_node<WeightedSumPolicy>(node_id, peers, options);
+    } else if (score == ExpectedWaitPolicy::kName) {
+        return run_node<ExpectedWaitPolicy>(node_id, peers, options);
+    } else if (score == CapacityNormalizedPolicy::kName) {
+        return run_node<CapacityNormalizedPolicy>(node_id, peers, options);
+    } else if (score == DefaultSloPolicy::kName) {
+        return run_node<DefaultSloPolicy>(node_id, peers, options);
+    }
+    std::cerr << "Unknown scoring policy: " << score << "\n";
+    return 1;
 }
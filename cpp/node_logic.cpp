@@ -0,0 +1,64 @@
+#include "node_logic.h"
+
+void PeerScores::Heard(const std::string& peer, float score, int64_t now_ms) {
+    uint32_t id = scores_.Update(peer, score);
+    if (id >= heard_ms_.size()) {
+        heard_ms_.resize(id + 1, -1);
+    }
+    heard_ms_[id] = now_ms;
+}
+
+std::vector<std::string> PeerScores::Expire(int64_t now_ms, int64_t timeout_ms) {
+    std::vector<std::string> expired;
+    if (timeout_ms <= 0) {
+        return expired;
+    }
+    for (uint32_t id = 0; id < heard_ms_.size(); ++id) {
+        if (heard_ms_[id] >= 0 && now_ms - heard_ms_[id] > timeout_ms) {
+            expired.push_back(scores_.NodeName(id));
+            scores_.Remove(expired.back());
+            heard_ms_[id] = -1;
+        }
+    }
+    return expired;
+}
+
+const std::string& PeerScores::Elect(const std::string& self, float my_score) const {
+    if (scores_.empty()) {
+        return self;
+    }
+    // On a tie the smaller name wins, as in ScoreIndex, so idle nodes agree
+    float top = scores_.TopScore();
+    if (top > my_score || (top == my_score && scores_.TopNode() < self)) {
+        return scores_.TopNode();
+    }
+    return self;
+}
+
+std::vector<size_t> heartbeat_targets(size_t peers, size_t self, uint64_t round, int fanout) {
+    std::vector<size_t> targets;
+    size_t others = self < peers ? peers - 1 : peers;
+    if (fanout <= 0 || static_cast<size_t>(fanout) >= others) {
+        for (size_t i = 0; i < peers; ++i) {
+            if (i != self) {
+                targets.push_back(i);
+            }
+        }
+        return targets;
+    }
+    // The others, in order starting after self, are (self + 1 + p) % peers for p < others
+    size_t base = self < peers ? self + 1 : 0;
+    uint64_t first = round * static_cast<uint64_t>(fanout);
+    for (int k = 0; k < fanout; ++k) {
+        size_t p = static_cast<size_t>((first + static_cast<uint64_t>(k)) % others);
+        targets.push_back((base + p) % peers);
+    }
+    return targets;
+}
+
+int64_t peer_expiry_ms(int64_t timeout_ms, size_t others, int fanout) {
+    if (timeout_ms <= 0 || fanout <= 0 || static_cast<size_t>(fanout) >= others) {
+        return timeout_ms;
+    }
+    return timeout_ms * static_cast<int64_t>((others + fanout - 1) / fanout);
+}
@@ -0,0 +1,73 @@
+#ifndef NODE_LOGIC_H
+#define NODE_LOGIC_H
+
+#include "host_stats.h"
+#include "score_index.h"
+#include "scoring.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The decisions a node makes about itself and its peers, with no gRPC,
+// threads or clock of their own. BasicNodeService calls them with
+// steady_clock time; bench/election_sim.cpp runs the same code on a virtual
+// clock. Times are in ms.
+
+// What a node's ScorePolicy is given; backlog is per worker
+inline ScoreInputs make_score_inputs(const HostLoad& host, float smoothed_queue, int64_t backlog_ms,
+                                     float expected_wait_ms, int workers) {
+    ScoreInputs in;
+    in.host = host;
+    in.queue_length = smoothed_queue;
+    in.backlog_ms = static_cast<float>(backlog_ms) / workers;
+    in.expected_wait_ms = expected_wait_ms;
+    in.capacity = static_cast<float>(workers);
+    return in;
+}
+
+// A node's load for dispatch, lower is better, from what its heartbeat
+// carries: the declared backlog per worker, or the smoothed forecast of its
+// wait when that is longer, as it is for tasks that run past what they
+// declare or declare nothing. Never the queue length, which says nothing of
+// how long the queued tasks take.
+inline float dispatch_load(int64_t backlog_ms, float capacity, float expected_wait_ms) {
+    return std::max(static_cast<float>(backlog_ms) / std::max(1.0f, capacity), expected_wait_ms);
+}
+
+// Peers' last advertised scores and when each was heard, and the election
+// over them
+class PeerScores {
+public:
+    void Heard(const std::string& peer, float score, int64_t now_ms);
+
+    // Forgets peers not heard from in timeout_ms and returns them; a
+    // timeout_ms of 0 or less keeps everyone
+    std::vector<std::string> Expire(int64_t now_ms, int64_t timeout_ms);
+
+    // The best scoring peer if it beats my_score, otherwise self; ties go to the smaller name
+    const std::string& Elect(const std::string& self, float my_score) const;
+
+    size_t size() const { return scores_.size(); }
+
+private:
+    ScoreIndex scores_;  // best on top
+    std::vector<int64_t> heard_ms_;  // by ScoreIndex id, -1 for ids not in use
+};
+
+// Indexes into a list of peers that get this round's heartbeat. A fanout of
+// 0 means every peer but self. Otherwise each round takes the next fanout
+// peers in a rotation that starts at self, so every peer still hears from
+// this node once in every peers / fanout rounds, and no peer hears from
+// everyone in the same round.
+std::vector<size_t> heartbeat_targets(size_t peers, size_t self, uint64_t round, int fanout);
+
+// How long a peer may stay silent before Expire drops it. With a fanout each
+// peer is heard only once in every ceil(others / fanout) rounds, so the
+// configured timeout, meant for a heartbeat every round, is multiplied by
+// that many rounds: a peer still expires after the same number of missed
+// heartbeats, rather than between two of its turns.
+int64_t peer_expiry_ms(int64_t timeout_ms, size_t others, int fanout);
+
+#endif // NODE_LOGIC_H
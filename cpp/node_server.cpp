@@ -1,129 +1,883 @@
 #include "node_server.h"
+#include "flight_recorder.h"
+#include "host_stats.h"
+#include "log.h"
+#include "trace.h"
 #include "utils.h"
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
-#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
 
-NodeServiceImpl::NodeServiceImpl(const std::string& node_id)
-    : node_id_(node_id), current_score_(0.0f) {}
+constexpr size_t kTopLockSites = 10;  // lock call sites reported by GetStats
 
-grpc::Status NodeServiceImpl::Heartbeat(grpc::ServerContext*,
-                                        const leader::NodeStatus* request,
-                                        leader::Ack* reply) {
+// Load a peer reported in its last heartbeat; lower is better
+static float status_load(const leader::NodeStatus& status) {
+    return dispatch_load(status.backlog_ms(), status.capacity(), status.expected_wait_ms());
+}
+
+template <typename T>
+static double total_over_sites(const ProfiledMutex& m, T LockSiteProfile::*field) {
+    double total = 0.0;
+    for (const LockSiteProfile& site : m.Profile()) {
+        total += static_cast<double>(site.*field);
+    }
+    return total;
+}
+
+// The clock node_logic.h decisions run on here
+static int64_t steady_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// The first node to take a task stamps when, and an ID to follow it by in traces
+static void stamp_first_receipt(leader::Task& task) {
+    if (task.received_us() == 0) {
+        task.set_received_us(wall_clock_us());
+    }
+    if (task.trace_id() == 0) {
+        thread_local std::mt19937_64 rng(std::random_device{}());
+        uint64_t id;
+        do {
+            id = rng();
+        } while (id == 0);
+        task.set_trace_id(id);
+    }
+}
+
+bool parse_node_option(const std::string& arg, NodeOptions* options) {
+    if (arg == "--lock_profile") {
+        set_lock_profile_sample(kDefaultLockProfileSample);
+        return true;
+    }
+    size_t eq = arg.find('=');
+    if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+        return false;
+    }
+    std::string name = arg.substr(2, eq - 2);
+    std::string value = arg.substr(eq + 1);
+
+    if (name == "dispatch") {
+        return parse_dispatch_mode(value, &options->dispatch_mode);
+    } else if (name == "choices") {
+        options->dispatch_choices = std::max(1, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "steal_batch") {
+        options->steal_batch = std::max(0, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "virtual_nodes") {
+        options->virtual_nodes = std::max(1, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "affinity_load") {
+        options->affinity_load_factor = std::max(0.0, std::atof(value.c_str()));
+        return true;
+    } else if (name == "batch_size") {
+        options->forwarding.max_batch = std::max(1, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "flush_us") {
+        options->forwarding.flush_interval_us = std::max(0, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "max_in_flight") {
+        options->forwarding.max_in_flight = std::max(1, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "host_sample_ms") {
+        options->host_sample_ms = std::max(10, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "ewma_ms") {
+        options->ewma_time_constant_ms = std::max(1.0, std::atof(value.c_str()));
+        return true;
+    } else if (name == "workers") {
+        options->workers = std::max(1, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "metrics_port") {
+        options->metrics_port = std::max(0, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "heartbeat_ms") {
+        options->heartbeat_interval_ms = std::max(1, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "election_ms") {
+        options->election_interval_ms = std::max(1, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "peer_timeout_ms") {
+        options->peer_timeout_ms = std::max(0, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "heartbeat_fanout") {
+        options->heartbeat_fanout = std::max(0, std::atoi(value.c_str()));
+        return true;
+    } else if (name == "record") {
+        options->record_file = value;
+        return true;
+    } else if (name == "log_level") {
+        LogLevel level;
+        if (!parse_log_level(value, &level)) {
+            return false;
+        }
+        set_log_level(level);
+        return true;
+    } else if (name == "log_sample") {
+        set_log_sample_every(std::atoi(value.c_str()));
+        return true;
+    } else if (name == "lock_profile") {
+        set_lock_profile_sample(std::atoi(value.c_str()));
+        return true;
+    } else if (name == "trace") {
+        if (value != "on" && value != "off") {
+            return false;
+        }
+        trace_set_enabled(value == "on");
+        return true;
+    }
+    return false;
+}
+
+NodeMetrics::NodeMetrics(MetricsRegistry& r)
+    : tasks_received(r.AddCounter("node_tasks_received_total", "Tasks received through AssignTask")),
+      tasks_forwarded(r.AddCounter("node_tasks_forwarded_total", "Tasks this node dispatched to peers")),
+      tasks_completed(r.AddCounter("node_tasks_completed_total", "Tasks run to completion here")),
+      tasks_stolen(r.AddCounter("node_tasks_stolen_total", "Tasks this node stole from peers")),
+      heartbeats_received(r.AddCounter("node_heartbeats_received_total", "Heartbeats taken from peers")),
+      heartbeat_failures(r.AddCounter("node_heartbeat_failures_total", "Heartbeats that got no reply")),
+      elections(r.AddCounter("node_elections_total", "Election rounds run")),
+      leader_changes(r.AddCounter("node_leader_changes_total", "Times this node saw the leader change")),
+      queue_wait_ms(r.AddHistogram("node_queue_wait_ms", "Time tasks spent queued here",
+                                   exponential_buckets(0.5, 2.0, 18))),
+      task_run_ms(r.AddHistogram("node_task_run_ms", "Task execution time",
+                                 exponential_buckets(0.5, 2.0, 18))),
+      heartbeat_rtt_ms(r.AddHistogram("node_heartbeat_rtt_ms", "Heartbeat round trip time",
+                                      exponential_buckets(0.1, 2.0, 14))),
+      heartbeat_round_ms(r.AddHistogram("node_heartbeat_round_ms", "Time to send one round of heartbeats",
+                                        exponential_buckets(0.5, 2.0, 18))) {}
+
+template <typename ScorePolicy>
+BasicNodeService<ScorePolicy>::BasicNodeService(const std::string& node_id, const NodeOptions& options)
+    : node_id_(node_id), options_(options),
+      load_(options.ewma_time_constant_ms, options.workers),
+      metrics_(metrics_registry_),
+      hash_ring_(options.virtual_nodes),
+      forwarder_(options.forwarding,
+                 [this](const std::string& peer) { return GetStub(peer); },
+                 [this](const std::string& peer, std::vector<leader::Task>& tasks) {
+                     RequeueFailedForward(peer, tasks);
+                 }) {
+    options_.workers = std::max(1, options_.workers);
+    start_host_sampler(options_.host_sample_ms);
+
+    metrics_registry_.AddGaugeFn("node_queue_depth", "Tasks waiting in the queue",
+        [this] { return static_cast<double>(queue_length_.load(std::memory_order_relaxed)); });
+    metrics_registry_.AddGaugeFn("node_backlog_ms", "Declared duration of queued and running tasks",
+        [this] { return static_cast<double>(backlog_ms_.load(std::memory_order_relaxed)); });
+    metrics_registry_.AddGaugeFn("node_score", "Score in the last heartbeat",
+        [this] { return static_cast<double>(current_score_.load(std::memory_order_relaxed)); });
+    metrics_registry_.AddGaugeFn("node_is_leader", "1 if this node thinks it is the leader",
+        [this] {
+            PROFILED_LOCK(lock, peers_mutex_, "metrics");
+            return leader_id_ == node_id_ ? 1.0 : 0.0;
+        });
+    for (ProfiledMutex* m : {&queue_mutex_, &peers_mutex_, &stubs_mutex_}) {
+        std::string labels = std::string("lock=\"") + m->name() + "\"";
+        metrics_registry_.AddGaugeFn("node_lock_contended", "Acquisitions that found the lock held, while profiling",
+            [m] { return total_over_sites(*m, &LockSiteProfile::contended); }, labels);
+    }
+    for (ProfiledMutex* m : {&queue_mutex_, &peers_mutex_, &stubs_mutex_}) {
+        std::string labels = std::string("lock=\"") + m->name() + "\"";
+        metrics_registry_.AddGaugeFn("node_lock_wait_ms", "Time spent waiting for the lock, while profiling",
+            [m] { return total_over_sites(*m, &LockSiteProfile::wait_total_ms); }, labels);
+    }
+}
+
+template <typename ScorePolicy>
+grpc::Status BasicNodeService<ScorePolicy>::Heartbeat(grpc::ServerContext*,
+                                                      const leader::NodeStatus* request,
+                                                      leader::Ack* reply) {
     {
-        std::lock_guard<std::mutex> lock(queue_mutex_);
-        peer_scores_[request->node_id()] = request->score();  // Save peer's score
+        PROFILED_LOCK(lock, peers_mutex_, "Heartbeat");
+        peer_scores_.Heard(request->node_id(), request->score(), steady_ms());  // Save peer's score
+        if (!off_ring_.empty() && off_ring_.erase(request->node_id()) > 0) {
+            hash_ring_.AddNode(request->node_id());  // back from a timeout; its keys return to it
+        }
+        leader::NodeStatus& status = peer_status_[request->node_id()];
+        capacities_changed_ |= status.capacity() != request->capacity();
+        status = *request;
+        peer_loads_.Update(request->node_id(), -status_load(*request));
     }
+    metrics_.heartbeats_received.Inc();
+    flight_record(FlightEvent::HEARTBEAT_RECV, request->queue_length(), request->backlog_ms(),
+                  std::lround(request->score() * 1000), request->node_id());
 
-    std::cout << "[HEARTBEAT] Received from " << request->node_id()
-              << " Score: " << request->score() << "\n";
+    LOG_SAMPLED(LogLevel::INFO, "HEARTBEAT", "Received from {} Score: {}",
+                request->node_id(), request->score());
 
     reply->set_message("ACK");
     return grpc::Status::OK;
 }
 
-grpc::Status NodeServiceImpl::AssignTask(grpc::ServerContext*,
-                                         const leader::Task* request,
-                                         leader::Ack* reply) {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    task_queue_.push(*request);
-    std::cout << "[TASK RECEIVED] Task ID: " << request->task_id() << "\n";
+template <typename ScorePolicy>
+grpc::Status BasicNodeService<ScorePolicy>::AssignTask(grpc::ServerContext*,
+                                                       const leader::Task* request,
+                                                       leader::Ack* reply) {
+    metrics_.tasks_received.Inc();
+    leader::Task task = *request;
+    stamp_first_receipt(task);
+    if (!options_.record_file.empty() && !task.forwarded()) {
+        recorder_.Append(task, task.received_us());
+    }
+    TraceSpan span("task", "AssignTask");
+    span.Arg("task_id", task.task_id());
+    span.FlowOut(task.trace_id());  // to wherever the task runs
+    if (!task.forwarded() && options_.dispatch_mode != DispatchMode::LOCAL) {
+        std::string target = PickDispatchTarget(task);
+        if (target != node_id_) {
+            span.Arg("target", target);
+            flight_record(FlightEvent::FORWARD, task.task_id(), 0, task.trace_id(), target);
+            task.set_forwarded(true);
+            forwarder_.Enqueue(target, std::move(task));
+            metrics_.tasks_forwarded.Inc();
+            reply->set_message("Task forwarded to " + target + ".");
+            return grpc::Status::OK;
+        }
+    }
+
+    {
+        PROFILED_LOCK(lock, queue_mutex_, "AssignTask");
+        EnqueueLocked(std::move(task));
+    }
+    LOG_SAMPLED(LogLevel::INFO, "TASK RECEIVED", "Task ID: {}", request->task_id());
     reply->set_message("Task received.");
     return grpc::Status::OK;
 }
 
-void NodeServiceImpl::ProcessTasks() {
-    while (true) {
-        if (!task_queue_.empty()) {
-            leader::Task task;
+// Batches arrive from a Forwarder, a leader's or a steal victim's, and are always kept here.
+template <typename ScorePolicy>
+grpc::Status BasicNodeService<ScorePolicy>::AssignTasks(grpc::ServerContext*,
+                                                        const leader::TaskBatch* request,
+                                                        leader::Ack* reply) {
+    TraceSpan span("task", "AssignTasks");
+    span.Arg("tasks", request->tasks_size());
+    if (!options_.record_file.empty()) {
+        int64_t now_us = wall_clock_us();
+        for (const auto& task : request->tasks()) {
+            if (!task.forwarded()) {
+                recorder_.Append(task, task.received_us() != 0 ? task.received_us() : now_us);
+            }
+        }
+    }
+    {
+        PROFILED_LOCK(lock, queue_mutex_, "AssignTasks");
+        for (const auto& task : request->tasks()) {
+            EnqueueLocked(task);
+        }
+    }
+    LOG_SAMPLED(LogLevel::INFO, "TASK RECEIVED", "Batch of {} tasks", request->tasks_size());
+    reply->set_message("Tasks received.");
+    return grpc::Status::OK;
+}
+
+// Hands over up to half of the queue, taken from the tail, so the victim keeps
+// the tasks it is about to run. Workers pop under the same lock, so a task is
+// either run here or stolen, never both. The tasks go to the thief as a
+// forwarded batch rather than in the reply: a reply the thief never gets
+// would lose them, while a batch it does not acknowledge is run here.
+template <typename ScorePolicy>
+grpc::Status BasicNodeService<ScorePolicy>::StealTasks(grpc::ServerContext*,
+                                                       const leader::StealRequest* request,
+                                                       leader::StealReply* reply) {
+    TraceSpan span("steal", "StealTasks");
+    span.Arg("thief", request->node_id());
+    std::vector<leader::Task> stolen;
+    {
+        PROFILED_LOCK(lock, queue_mutex_, "StealTasks");
+        size_t n = std::min(static_cast<size_t>(std::max(0, request->max_tasks())),
+                            task_queue_.size() / 2);
+        auto first = task_queue_.end() - static_cast<std::ptrdiff_t>(n);
+        for (auto it = first; it != task_queue_.end(); ++it) {
+            backlog_ms_.fetch_sub(it->task.duration_ms(), std::memory_order_relaxed);
+            stolen.push_back(std::move(it->task));
+        }
+        task_queue_.erase(first, task_queue_.end());
+        queue_length_.store(static_cast<int>(task_queue_.size()), std::memory_order_relaxed);
+    }
+    span.Arg("tasks", static_cast<int64_t>(stolen.size()));
+    flight_record(FlightEvent::STOLEN, stolen.size(), 0, 0, request->node_id());
+    reply->set_tasks(static_cast<int32_t>(stolen.size()));
+
+    for (auto& task : stolen) {
+        task.set_forwarded(true);  // the thief keeps it
+        forwarder_.Enqueue(request->node_id(), std::move(task));
+    }
+    if (!stolen.empty()) {
+        LOG_INFO("STEAL", "{} took {} tasks", request->node_id(), stolen.size());
+    }
+    return grpc::Status::OK;
+}
+
+// Caller holds queue_mutex_.
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::EnqueueLocked(leader::Task task) {
+    stamp_first_receipt(task);
+    backlog_ms_.fetch_add(task.duration_ms(), std::memory_order_relaxed);
+    task_queue_.push_back({std::move(task), std::chrono::steady_clock::now()});
+    queue_length_.store(static_cast<int>(task_queue_.size()), std::memory_order_relaxed);
+    load_.RecordArrivals(1);
+    flight_record(FlightEvent::ENQUEUE, task_queue_.back().task.task_id(), task_queue_.size(),
+                  task_queue_.back().task.trace_id());
+}
+
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::ProcessTasks() {
+    while (!stopping_.load(std::memory_order_relaxed)) {
+        leader::Task task;
+        bool has_task = false;
+        int64_t queued_us = 0;
+        {
+            PROFILED_LOCK(lock, queue_mutex_, "ProcessTasks");
+            if (!task_queue_.empty()) {
+                QueuedTask& front = task_queue_.front();
+                auto waited = std::chrono::steady_clock::now() - front.enqueued;
+                metrics_.queue_wait_ms.Observe(std::chrono::duration<double, std::milli>(waited).count());
+                queued_us = std::chrono::duration_cast<std::chrono::microseconds>(waited).count();
+                // Here, not in EnqueueLocked, so a task queued on a node it is stolen
+                // from or forwarded away from counts once, where it runs
+                latency_.Record(TaskPhase::RECEIVE, front.task.priority(),
+                                wall_clock_us() - queued_us - front.task.received_us());
+                latency_.Record(TaskPhase::QUEUE, front.task.priority(), queued_us);
+                task = std::move(front.task);
+                task_queue_.pop_front();
+                queue_length_.store(static_cast<int>(task_queue_.size()), std::memory_order_relaxed);
+                flight_record(FlightEvent::DEQUEUE, task.task_id(), queued_us, task_queue_.size());
+                has_task = true;
+            }
+        }
+
+        if (has_task) {
+            auto start = std::chrono::steady_clock::now();
             {
-                std::lock_guard<std::mutex> lock(queue_mutex_);
-                task = task_queue_.front();
-                task_queue_.pop();
+                TraceSpan span("task", "run");
+                span.Arg("task_id", task.task_id());
+                span.Arg("priority", task.priority());
+                span.Arg("queued_us", queued_us);
+                span.FlowIn(task.trace_id());
+                simulate_task(task.task_id(), task.duration_ms());
             }
-            simulate_task(task.task_id(), task.duration_ms());
-        } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            auto ran = std::chrono::steady_clock::now() - start;
+            double run_ms = std::chrono::duration<double, std::milli>(ran).count();
+            latency_.Record(TaskPhase::EXECUTE, task.priority(),
+                            std::chrono::duration_cast<std::chrono::microseconds>(ran).count());
+            latency_.Record(TaskPhase::TOTAL, task.priority(), wall_clock_us() - task.received_us());
+            load_.RecordCompletion(run_ms);
+            runtimes_.Record(run_ms);
+            metrics_.task_run_ms.Observe(run_ms);
+            metrics_.tasks_completed.Inc();
+            flight_record(FlightEvent::DONE, task.task_id(),
+                          std::chrono::duration_cast<std::chrono::microseconds>(ran).count());
+            // Counted until it finishes, not just until dequeued
+            backlog_ms_.fetch_sub(task.duration_ms(), std::memory_order_relaxed);
+        } else if (!TryStealTasks()) {
+            SleepUnlessStopped(100);
         }
     }
 }
 
-void NodeServiceImpl::SendHeartbeatToPeer(const std::string& peer_address) {
-    auto channel = grpc::CreateChannel(peer_address, grpc::InsecureChannelCredentials());
-    std::unique_ptr<leader::NodeService::Stub> stub = leader::NodeService::NewStub(channel);
+template <typename ScorePolicy>
+grpc::Status BasicNodeService<ScorePolicy>::GetStats(grpc::ServerContext*,
+                                                     const leader::StatsRequest*,
+                                                     leader::NodeStats* reply) {
+    RuntimeQuantiles::Snapshot runtimes = runtimes_.Get();
+    reply->set_node_id(node_id_);
+    reply->set_capacity(options_.workers);
+    reply->set_tasks_completed(runtimes.count);
+    reply->set_arrival_rate(load_.arrival_rate());
+    reply->set_service_rate(runtimes.count > 0 ? load_.service_rate() : 0.0);
+    reply->set_service_mean_ms(runtimes.count > 0 ? load_.service_ms() : 0.0);
+    reply->set_service_p50_ms(runtimes.p50_ms);
+    reply->set_service_p90_ms(runtimes.p90_ms);
+    reply->set_service_p99_ms(runtimes.p99_ms);
+    reply->set_drain_ms(load_.DrainTimeMs());
+    int queue_length = queue_length_.load(std::memory_order_relaxed);
+    reply->set_queue_length(queue_length);
+    reply->set_backlog_ms(backlog_ms_.load(std::memory_order_relaxed));
+    reply->set_expected_wait_ms(load_.ExpectedWaitMs(queue_length, 0.0));
 
-    leader::NodeStatus status;
+    for (const MetricSnapshot& m : metrics_registry_.Snapshot()) {
+        leader::Metric* metric = reply->add_metrics();
+        metric->set_name(m.name);
+        metric->set_labels(m.labels);
+        metric->set_type(m.type == MetricType::COUNTER ? "counter" :
+                         m.type == MetricType::GAUGE ? "gauge" : "histogram");
+        metric->set_value(m.value);
+        metric->mutable_bucket_bounds()->Add(m.bounds.begin(), m.bounds.end());
+        metric->mutable_bucket_counts()->Add(m.counts.begin(), m.counts.end());
+        metric->set_sum(m.sum);
+        metric->set_count(m.count);
+    }
+
+    for (int phase = 0; phase < kTaskPhases; ++phase) {
+        for (int cls = 0; cls < kPriorityClasses; ++cls) {
+            const HdrHistogram& h = latency_.Get(static_cast<TaskPhase>(phase), cls);
+            if (h.TotalCount() == 0) {
+                continue;
+            }
+            leader::PhaseLatency* latency = reply->add_latency();
+            latency->set_phase(phase_name(static_cast<TaskPhase>(phase)));
+            latency->set_priority(priority_class_name(cls));
+            latency->set_count(h.TotalCount());
+            latency->set_mean_ms(h.Mean() / 1000.0);
+            latency->set_p50_ms(h.ValueAtPercentile(50.0) / 1000.0);
+            latency->set_p90_ms(h.ValueAtPercentile(90.0) / 1000.0);
+            latency->set_p99_ms(h.ValueAtPercentile(99.0) / 1000.0);
+            latency->set_p999_ms(h.ValueAtPercentile(99.9) / 1000.0);
+            latency->set_max_ms(h.Max() / 1000.0);
+        }
+    }
+
+    std::vector<LockSiteProfile> sites;
+    for (ProfiledMutex* m : {&queue_mutex_, &peers_mutex_, &stubs_mutex_}) {
+        std::vector<LockSiteProfile> profile = m->Profile();
+        sites.insert(sites.end(), profile.begin(), profile.end());
+    }
+    std::sort(sites.begin(), sites.end(), [](const LockSiteProfile& a, const LockSiteProfile& b) {
+        return a.wait_total_ms > b.wait_total_ms;
+    });
+    sites.resize(std::min(sites.size(), kTopLockSites));
+    for (const LockSiteProfile& site : sites) {
+        leader::LockProfile* entry = reply->add_locks();
+        entry->set_lock(site.lock);
+        entry->set_site(site.site);
+        entry->set_acquisitions(site.acquisitions);
+        entry->set_contended(site.contended);
+        entry->set_wait_total_ms(site.wait_total_ms);
+        entry->set_wait_p50_us(site.wait_p50_us);
+        entry->set_wait_p99_us(site.wait_p99_us);
+        entry->set_wait_max_us(site.wait_max_us);
+        entry->set_hold_p50_us(site.hold_p50_us);
+        entry->set_hold_p99_us(site.hold_p99_us);
+        entry->set_hold_max_us(site.hold_max_us);
+    }
+
+    PROFILED_LOCK(lock, peers_mutex_, "GetStats");
+    reply->set_leader_id(leader_id_);
+    return grpc::Status::OK;
+}
+
+template <typename ScorePolicy>
+grpc::Status BasicNodeService<ScorePolicy>::Trace(grpc::ServerContext*,
+                                                  const leader::TraceRequest* request,
+                                                  leader::TraceReply* reply) {
+    trace_set_enabled(request->enable());
+    reply->set_node_id(node_id_);
+    if (request->collect()) {
+        int64_t events = 0;
+        int64_t dropped = 0;
+        reply->set_events_json(trace_dump_events(node_id_, true, &events, &dropped));
+        reply->set_events(events);
+        reply->set_dropped(dropped);
+    }
+    LOG_INFO("TRACE", "Tracing {}, {} events collected", request->enable() ? "on" : "off", reply->events());
+    return grpc::Status::OK;
+}
+
+// Asks the peer with the longest reported queue for a batch of its work.
+template <typename ScorePolicy>
+bool BasicNodeService<ScorePolicy>::TryStealTasks() {
+    if (options_.steal_batch <= 0) {
+        return false;
+    }
+
+    // Steal from the peer with the most queued tasks per worker; a peer with
+    // a single queued task has nothing to spare
+    std::string victim;
+    int victim_queue = 0;
+    float most_per_worker = 0.0f;
     {
-        std::lock_guard<std::mutex> lock(queue_mutex_);
-        current_score_ = compute_score(task_queue_.size());
-        status.set_node_id(node_id_);
-        status.set_score(current_score_);
-        status.set_queue_length(task_queue_.size());
+        PROFILED_LOCK(lock, peers_mutex_, "TryStealTasks");
+        for (const auto& [peer_id, status] : peer_status_) {
+            float per_worker = status.queue_length() / std::max(1.0f, status.capacity());
+            if (status.queue_length() > 1 && per_worker > most_per_worker) {
+                victim = peer_id;
+                victim_queue = status.queue_length();
+                most_per_worker = per_worker;
+            }
+        }
+    }
+    if (victim.empty()) {
+        return false;
     }
 
-    leader::Ack ack;
+    TraceSpan span("steal", "steal");
+    span.Arg("victim", victim);
+
+    leader::StealRequest request;
+    request.set_node_id(node_id_);
+    request.set_max_tasks(options_.steal_batch);
+
+    leader::StealReply reply;
     grpc::ClientContext context;
-    grpc::Status s = stub->Heartbeat(&context, status, &ack);
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(1));
+    grpc::Status s = GetStub(victim)->StealTasks(&context, request, &reply);
+    int stolen = s.ok() ? reply.tasks() : 0;
 
-    if (!s.ok()) {
-        std::cerr << "[ERROR] Heartbeat to " << peer_address << " failed.\n";
+    {
+        PROFILED_LOCK(lock, peers_mutex_, "TryStealTasks");
+        // Don't go back to the same peer until its next heartbeat says it still has work
+        auto it = peer_status_.find(victim);
+        if (it != peer_status_.end()) {
+            int remaining = s.ok() ? std::max(0, victim_queue - stolen) : 0;
+            it->second.set_queue_length(remaining);
+            it->second.set_expected_wait_ms(it->second.expected_wait_ms() * remaining / victim_queue);
+            // The tasks' durations are not known here, so scale the backlog like the wait
+            it->second.set_backlog_ms(it->second.backlog_ms() * remaining / victim_queue);
+            peer_loads_.Update(victim, -status_load(it->second));
+        }
+    }
+    span.Arg("tasks", stolen);
+    flight_record(FlightEvent::STEAL, s.ok() ? stolen : -1, 0, 0, victim);
+    if (stolen == 0) {
+        return false;
     }
+    metrics_.tasks_stolen.Inc(stolen);
+    LOG_INFO("STEAL", "{} tasks coming from {}", stolen, victim);
+
+    // They arrive through AssignTasks within a forwarder flush; wait for them
+    // rather than go looking for more work in the meantime
+    auto give_up = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (queue_length_.load(std::memory_order_relaxed) == 0 && !stopping_.load(std::memory_order_relaxed) &&
+           std::chrono::steady_clock::now() < give_up) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
 }
 
-void NodeServiceImpl::StartHeartbeatLoop(const std::vector<std::string>& peers) {
-    peer_addresses_ = peers;  // save peers for election use
+// A task with a routing key goes to the key's owner from whichever node gets
+// it, so every node sends a key to the same place while their rings agree.
+// Other tasks are placed by the leader; any other node keeps them.
+template <typename ScorePolicy>
+std::string BasicNodeService<ScorePolicy>::PickDispatchTarget(const leader::Task& task) {
+    static thread_local std::mt19937 rng(std::random_device{}());
 
-    std::thread([this]() {
-        while (true) {
+    PROFILED_LOCK(lock, peers_mutex_, "PickDispatchTarget");
+    if (peer_addresses_.empty()) {
+        return node_id_;
+    }
+
+    std::string target;
+    if (!task.routing_key().empty() && !hash_ring_.empty()) {
+        target = PickAffinityTarget(task.routing_key());
+    } else if (leader_id_ != node_id_) {
+        return node_id_;
+    } else if (options_.dispatch_mode == DispatchMode::GREEDY) {
+        // The least loaded peer is always on top of peer_loads_
+        target = node_id_;
+        if (!peer_loads_.empty() && -peer_loads_.TopScore() < PeerLoad(node_id_)) {
+            target = peer_loads_.TopNode();
+        }
+    } else {
+        // Candidates are drawn in proportion to capacity, so a node with 8
+        // workers is offered about 8 times the tasks of a node with one
+        if (capacities_changed_) {
+            std::vector<double> weights;
             for (const auto& peer : peer_addresses_) {
-                if (peer != node_id_) {
-                    SendHeartbeatToPeer(peer);
-                }
+                weights.push_back(PeerCapacity(peer));
             }
-            std::this_thread::sleep_for(std::chrono::seconds(2));
+            capacity_sampler_.Assign(weights);
+            capacities_changed_ = false;
         }
-    }).detach();
+        auto load = [this](size_t i) { return PeerLoad(peer_addresses_[i]); };
+        auto sample = [this]() { return capacity_sampler_.Sample(rng); };
+        target = peer_addresses_[pick_target_sampled(options_.dispatch_mode, peer_addresses_.size(),
+                                                     options_.dispatch_choices, sample, load)];
+    }
 
-    std::thread([this]() {
-        ElectionLoop();
-    }).detach();
+    if (std::isinf(PeerLoad(target))) {
+        return node_id_;
+    }
+    return target;
 }
 
-void NodeServiceImpl::ElectionLoop() {
-    while (true) {
-        std::this_thread::sleep_for(std::chrono::seconds(5)); // run election every 5s
+// Same key, same node, unless that node already carries more than
+// affinity_load_factor times the average load. Caller holds peers_mutex_.
+template <typename ScorePolicy>
+std::string BasicNodeService<ScorePolicy>::PickAffinityTarget(const std::string& key) {
+    if (options_.affinity_load_factor <= 0.0) {
+        return hash_ring_.Owner(key);
+    }
 
-        std::lock_guard<std::mutex> lock(queue_mutex_);
+    double total = 0.0;
+    size_t known = 0;
+    for (const auto& peer : peer_addresses_) {
+        float l = PeerLoad(peer);
+        if (!std::isinf(l)) {
+            total += l;
+            ++known;
+        }
+    }
+    double average = known > 0 ? total / known : 0.0;
+    double max_load = options_.affinity_load_factor * average + 1.0;
+    return hash_ring_.BoundedOwner(key, max_load,
+                                   [this](const std::string& peer) { return PeerLoad(peer); });
+}
 
-        std::string best_node = node_id_;
-        float best_score = current_score_;
+// Expected wait at peer as last seen, per worker. Caller holds peers_mutex_.
+template <typename ScorePolicy>
+float BasicNodeService<ScorePolicy>::PeerLoad(const std::string& peer) const {
+    if (peer == node_id_) {
+        // On the scale peers report: as status_load() of the heartbeat this node would send now
+        return dispatch_load(backlog_ms_.load(std::memory_order_relaxed), static_cast<float>(options_.workers),
+                             AdvertisedWaitMs());
+    }
+    auto it = peer_status_.find(peer);
+    if (it == peer_status_.end()) {
+        return std::numeric_limits<float>::infinity();  // no heartbeat yet
+    }
+    return status_load(it->second);
+}
 
-        for (const auto& [peer_id, score] : peer_scores_) {
-            if (score > best_score) {
-                best_node = peer_id;
-                best_score = score;
+// Workers at peer as last advertised, 1 until it has said. Caller holds peers_mutex_.
+template <typename ScorePolicy>
+float BasicNodeService<ScorePolicy>::PeerCapacity(const std::string& peer) const {
+    if (peer == node_id_) {
+        return static_cast<float>(options_.workers);
+    }
+    auto it = peer_status_.find(peer);
+    if (it == peer_status_.end()) {
+        return 1.0f;
+    }
+    return std::max(1.0f, it->second.capacity());
+}
+
+// A dispatched batch that could not be delivered is run here instead of being lost.
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::RequeueFailedForward(const std::string& peer_address,
+                                                         std::vector<leader::Task>& tasks) {
+    LOG_ERROR("ERROR", "Forwarding {} tasks to {} failed, running them locally.",
+              tasks.size(), peer_address);
+    PROFILED_LOCK(lock, queue_mutex_, "RequeueFailedForward");
+    for (auto& task : tasks) {
+        EnqueueLocked(std::move(task));
+    }
+}
+
+template <typename ScorePolicy>
+leader::NodeService::Stub* BasicNodeService<ScorePolicy>::GetStub(const std::string& peer_address) {
+    PROFILED_LOCK(lock, stubs_mutex_, "GetStub");
+    auto& stub = stubs_[peer_address];
+    if (!stub) {
+        // Reconnect to a restarted peer by its next heartbeat, not after gRPC's default backoff of up to 2 min
+        grpc::ChannelArguments args;
+        args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, std::max(100, options_.heartbeat_interval_ms));
+        auto channel = grpc::CreateCustomChannel(peer_address, grpc::InsecureChannelCredentials(), args);
+        stub = leader::NodeService::NewStub(channel);
+    }
+    return stub.get();
+}
+
+// Receivers act on this until our next heartbeat, so forecast that far ahead
+template <typename ScorePolicy>
+float BasicNodeService<ScorePolicy>::AdvertisedWaitMs() const {
+    return load_.ExpectedWaitMs(load_.smoothed_queue(), options_.heartbeat_interval_ms);
+}
+
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::SendHeartbeatToPeer(const std::string& peer_address) {
+    float expected_wait = AdvertisedWaitMs();
+    int64_t backlog_ms = backlog_ms_.load(std::memory_order_relaxed);
+
+    float score = ScorePolicy::Score(make_score_inputs(current_host_load(), load_.smoothed_queue(),
+                                                      backlog_ms, expected_wait, options_.workers));
+    current_score_.store(score, std::memory_order_relaxed);
+
+    leader::NodeStatus status;
+    status.set_node_id(node_id_);
+    status.set_score(score);
+    status.set_queue_length(queue_length_.load(std::memory_order_relaxed));
+    status.set_backlog_ms(backlog_ms);
+    status.set_expected_wait_ms(expected_wait);
+    status.set_drain_ms(load_.DrainTimeMs());
+    status.set_capacity(options_.workers);
+    RuntimeQuantiles::Snapshot runtimes = runtimes_.Get();
+    if (runtimes.count > 0) {
+        status.set_service_rate(load_.service_rate());
+        status.set_service_p99_ms(runtimes.p99_ms);
+    }
+
+    TraceSpan span("heartbeat", "heartbeat");
+    span.Arg("peer", peer_address);
+    leader::Ack ack;
+    grpc::ClientContext context;
+    auto start = std::chrono::steady_clock::now();
+    grpc::Status s = GetStub(peer_address)->Heartbeat(&context, status, &ack);
+    span.Arg("ok", s.ok());
+
+    auto rtt = std::chrono::steady_clock::now() - start;
+    flight_record(FlightEvent::HEARTBEAT_SEND, s.ok(),
+                  std::chrono::duration_cast<std::chrono::microseconds>(rtt).count(),
+                  std::lround(score * 1000), peer_address);
+    if (s.ok()) {
+        metrics_.heartbeat_rtt_ms.Observe(std::chrono::duration<double, std::milli>(rtt).count());
+    } else {
+        metrics_.heartbeat_failures.Inc();
+        LOG_ERROR("ERROR", "Heartbeat to {} failed.", peer_address);
+    }
+}
+
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::StartHeartbeatLoop(const std::vector<std::string>& peers) {
+    peer_addresses_ = peers;  // save peers for election use
+    for (const auto& peer : peer_addresses_) {
+        hash_ring_.AddNode(peer);
+    }
+    size_t others = peer_addresses_.size() - std::count(peer_addresses_.begin(), peer_addresses_.end(), node_id_);
+    peer_expiry_ms_ = peer_expiry_ms(options_.peer_timeout_ms, others, options_.heartbeat_fanout);
+    if (peer_expiry_ms_ != options_.peer_timeout_ms) {
+        LOG_WARN("INFO", "Heartbeat fanout {} over {} peers: peer timeout raised from {} to {} ms",
+                 options_.heartbeat_fanout, others, options_.peer_timeout_ms, peer_expiry_ms_);
+    }
+
+    threads_.emplace_back([this]() {
+        trace_set_thread_name("heartbeat");
+        size_t self = std::find(peer_addresses_.begin(), peer_addresses_.end(), node_id_) - peer_addresses_.begin();
+        uint64_t round = 0;
+        do {
+            load_.Update(queue_length_.load(std::memory_order_relaxed));
+
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i : heartbeat_targets(peer_addresses_.size(), self, round++, options_.heartbeat_fanout)) {
+                if (stopping_.load(std::memory_order_relaxed)) {
+                    break;  // a round to many slow peers would hold up Stop()
+                }
+                SendHeartbeatToPeer(peer_addresses_[i]);
             }
-        }
+            metrics_.heartbeat_round_ms.Observe(
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            recorder_.Flush();  // so a quiet node's trace is on disk too
+        } while (SleepUnlessStopped(options_.heartbeat_interval_ms));
+    });
+
+    threads_.emplace_back([this]() {
+        trace_set_thread_name("election");
+        ElectionLoop();
+    });
+}
+
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::ElectionLoop() {
+    while (SleepUnlessStopped(options_.election_interval_ms)) {
+        float my_score = current_score_.load(std::memory_order_relaxed);
+        PROFILED_LOCK(lock, peers_mutex_, "ElectionLoop");
 
+        metrics_.elections.Inc();
+        ExpirePeersLocked();
+        std::string best_node = peer_scores_.Elect(node_id_, my_score);
+
+        trace_instant("election", "election", "leader", best_node);
+        flight_record(FlightEvent::ELECTION, leader_id_ != best_node, 0, std::lround(my_score * 1000), best_node);
         if (leader_id_ != best_node) {
             leader_id_ = best_node;
+            metrics_.leader_changes.Inc();
             if (leader_id_ == node_id_) {
-                std::cout << "[LEADER] I am elected as the new leader!\n";
+                LOG_INFO("LEADER", "I am elected as the new leader!");
             } else {
-                std::cout << "[INFO] New leader elected: " << leader_id_ << "\n";
+                LOG_INFO("INFO", "New leader elected: {}", leader_id_);
             }
         }
     }
 }
 
-void NodeServiceImpl::Run(const std::string& server_address) {
+// A peer that has stopped sending heartbeats can no longer win an election,
+// be picked as least loaded or own routing keys. Its next heartbeat brings
+// it back.
+// Caller holds peers_mutex_.
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::ExpirePeersLocked() {
+    for (const std::string& peer : peer_scores_.Expire(steady_ms(), peer_expiry_ms_)) {
+        LOG_INFO("INFO", "No heartbeat from {} in {} ms, dropping it from elections and routing", peer,
+                 peer_expiry_ms_);
+        peer_loads_.Remove(peer);
+        hash_ring_.RemoveNode(peer);  // its keys move to the next owners on the ring
+        off_ring_.insert(peer);
+    }
+}
+
+template <typename ScorePolicy>
+bool BasicNodeService<ScorePolicy>::SleepUnlessStopped(int ms) {
+    std::unique_lock<std::mutex> lock(stop_mutex_);
+    return !stop_cv_.wait_for(lock, std::chrono::milliseconds(ms),
+                              [this] { return stopping_.load(std::memory_order_relaxed); });
+}
+
+template <typename ScorePolicy>
+int BasicNodeService<ScorePolicy>::Start(const std::string& server_address) {
+    int port = 0;
     grpc::ServerBuilder builder;
-    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials(), &port);
     builder.RegisterService(this);
-    std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
-    std::cout << "[STARTED] Node running at " << server_address << "\n";
+    server_ = builder.BuildAndStart();
+    if (!server_ || port == 0) {
+        LOG_ERROR("ERROR", "Could not listen on {}", server_address);
+        return 0;
+    }
+    LOG_INFO("STARTED", "Node running at {}", server_address);
+    if (options_.metrics_port > 0) {
+        if (metrics_http_.Start(options_.metrics_port, [this] { return metrics_registry_.PrometheusText(); })) {
+            LOG_INFO("STARTED", "Metrics at http://127.0.0.1:{}/metrics", options_.metrics_port);
+        } else {
+            LOG_ERROR("ERROR", "Could not serve metrics on port {}", options_.metrics_port);
+        }
+    }
+    if (!options_.record_file.empty()) {
+        if (recorder_.Open(options_.record_file)) {
+            LOG_INFO("STARTED", "Recording submitted tasks to {}", options_.record_file);
+        } else {
+            LOG_ERROR("ERROR", "Could not record tasks to {}", options_.record_file);
+        }
+    }
+
+    for (int i = 0; i < options_.workers; ++i) {
+        threads_.emplace_back([this, i] {
+            trace_set_thread_name("worker " + std::to_string(i));
+            ProcessTasks();
+        });
+    }
+    return port;
+}
+
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::Run(const std::string& server_address) {
+    if (Start(server_address) != 0) {
+        server_->Wait();
+    }
+}
+
+// Tasks still queued are dropped, as they would be if the process died
+template <typename ScorePolicy>
+void BasicNodeService<ScorePolicy>::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+        if (stopping_.exchange(true)) {
+            return;
+        }
+    }
+    stop_cv_.notify_all();
+    if (server_) {
+        server_->Shutdown(std::chrono::system_clock::now() + std::chrono::milliseconds(100));
+    }
+    metrics_http_.Stop();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+    forwarder_.Stop();
+    recorder_.Close();
+}
 
-    std::thread task_thread(&NodeServiceImpl::ProcessTasks, this);
-    server->Wait();
-    task_thread.join();
+template <typename ScorePolicy>
+BasicNodeService<ScorePolicy>::~BasicNodeService() {
+    Stop();
 }
+
+template class BasicNodeService<WeightedSumPolicy>;
+template class BasicNodeService<ExpectedWaitPolicy>;
+template class BasicNodeService<CapacityNormalizedPolicy>;
+template class BasicNodeService<DefaultSloPolicy>;
@@ -1,18 +1,86 @@
 #ifndef NODE_SERVER_H
 #define NODE_SERVER_H
 
+#include "dispatch.h"
+#include "forwarder.h"
+#include "hash_ring.h"
+#include "load_model.h"
+#include "lock_profile.h"
+#include "metrics.h"
+#include "metrics_http.h"
+#include "node_logic.h"
+#include "quantile.h"
+#include "score_index.h"
+#include "scoring.h"
+#include "task_latency.h"
+#include "task_trace.h"
 #include "leader.grpc.pb.h"
 #include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
 #include <thread>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
-class NodeServiceImpl final : public leader::NodeService::Service {
+struct NodeOptions {
+    DispatchMode dispatch_mode = DispatchMode::LOCAL;
+    int dispatch_choices = 2;  // d for POWER_OF_D
+    int steal_batch = 0;       // max tasks an idle node steals at once, 0 disables stealing
+    int virtual_nodes = 128;   // points per node on the routing_key hash ring
+    double affinity_load_factor = 1.25;  // spill keys off owners above this x average load, 0 never spills
+    ForwarderOptions forwarding;         // batching of dispatched tasks
+    int host_sample_ms = 1000;           // how often /proc and cgroup load is resampled
+    double ewma_time_constant_ms = 4000; // memory of the smoothed load averages
+    int workers = 1;                     // task threads, advertised to peers as capacity
+    int metrics_port = 0;                // serve Prometheus metrics on 127.0.0.1:port, 0 disables
+    int heartbeat_interval_ms = 2000;
+    int election_interval_ms = 5000;
+    int peer_timeout_ms = 6000;          // peers silent this long stop counting in elections, 0 never; longer with a fanout
+    int heartbeat_fanout = 0;            // peers sent each heartbeat round, 0 all; see heartbeat_targets
+    std::string record_file;             // append tasks clients submit here as a task trace, empty off
+};
+
+// Parse one "--name=value" flag into options; logging flags take effect at once
+bool parse_node_option(const std::string& arg, NodeOptions* options);
+
+// A task waiting in the queue, stamped so its queue wait can be measured
+struct QueuedTask {
+    leader::Task task;
+    std::chrono::steady_clock::time_point enqueued;
+};
+
+// What a node counts and times about itself; registered once per node
+struct NodeMetrics {
+    explicit NodeMetrics(MetricsRegistry& registry);
+
+    Counter& tasks_received;   // through AssignTask, before dispatch
+    Counter& tasks_forwarded;
+    Counter& tasks_completed;
+    Counter& tasks_stolen;     // taken from peers by this node
+    Counter& heartbeats_received;
+    Counter& heartbeat_failures;
+    Counter& elections;
+    Counter& leader_changes;
+    Histogram& queue_wait_ms;
+    Histogram& task_run_ms;
+    Histogram& heartbeat_rtt_ms;
+    Histogram& heartbeat_round_ms;  // sending to every target of one round
+};
+
+// ScorePolicy (see scoring.h) turns this node's load into the score it
+// advertises in heartbeats.
+template <typename ScorePolicy>
+class BasicNodeService final : public leader::NodeService::Service {
 public:
-    NodeServiceImpl(const std::string& node_id);
+    BasicNodeService(const std::string& node_id, const NodeOptions& options = NodeOptions());
+    ~BasicNodeService();
 
     grpc::Status Heartbeat(grpc::ServerContext* context,
                            const leader::NodeStatus* request,
@@ -22,21 +90,95 @@ public:
                             const leader::Task* request,
                             leader::Ack* reply) override;
 
+    grpc::Status StealTasks(grpc::ServerContext* context,
+                            const leader::StealRequest* request,
+                            leader::StealReply* reply) override;
+
+    grpc::Status AssignTasks(grpc::ServerContext* context,
+                             const leader::TaskBatch* request,
+                             leader::Ack* reply) override;
+
+    grpc::Status GetStats(grpc::ServerContext* context,
+                          const leader::StatsRequest* request,
+                          leader::NodeStats* reply) override;
+
+    grpc::Status Trace(grpc::ServerContext* context,
+                       const leader::TraceRequest* request,
+                       leader::TraceReply* reply) override;
+
+    // Serves on server_address and starts the workers; returns the bound port, 0 on failure
+    int Start(const std::string& server_address);
+    // Start, then block until Stop()
     void Run(const std::string& server_address);
     void StartHeartbeatLoop(const std::vector<std::string>& peer_addresses);
+    // Shuts the server down and joins every thread the node started
+    void Stop();
 
 private:
     std::string node_id_;
+    NodeOptions options_;
+    std::deque<QueuedTask> task_queue_;
+    ProfiledMutex queue_mutex_{"queue"};  // guards task_queue_ only
+
+    // This node's status, published by whichever thread changes it so that
+    // heartbeats, elections and dispatch can read it without queue_mutex_
+    std::atomic<int> queue_length_{0};      // task_queue_.size()
+    std::atomic<int64_t> backlog_ms_{0};    // sum of duration_ms over queued and running tasks
+    std::atomic<float> current_score_{0.0f};
+    LoadEstimator load_;  // smoothed rates and wait forecast for this node
+    RuntimeQuantiles runtimes_;  // measured task run times
+    TaskLatency latency_;        // per phase of tasks completed here
+    MetricsRegistry metrics_registry_;
+    NodeMetrics metrics_;
+    MetricsHttpServer metrics_http_;  // serving while options_.metrics_port is set
+    TaskTraceWriter recorder_;  // open while options_.record_file is set
+
+    ProfiledMutex peers_mutex_{"peers"};  // guards leader_id_ and what peers told us, below
     std::string leader_id_;
-    std::queue<leader::Task> task_queue_;
-    std::mutex queue_mutex_;
-    float current_score_;
-    std::unordered_map<std::string, float> peer_scores_; // new: keep scores from peers
+    PeerScores peer_scores_; // scores from peers and when they were heard, for ElectionLoop
+    std::unordered_map<std::string, leader::NodeStatus> peer_status_; // last heartbeat per peer, for dispatch
+    ScoreIndex peer_loads_;  // negated peer loads, so the least loaded peer is on top
     std::vector<std::string> peer_addresses_;
+    int64_t peer_expiry_ms_ = 0;  // peer_timeout_ms stretched for the heartbeat fanout; see peer_expiry_ms
+    WeightedSampler capacity_sampler_;  // over peer_addresses_, by advertised capacity
+    bool capacities_changed_ = true;
+    HashRing hash_ring_;  // peer_addresses_ less off_ring_, routes tasks that carry a routing_key
+    std::unordered_set<std::string> off_ring_;  // expired peers, put back on their next heartbeat
+
+    ProfiledMutex stubs_mutex_{"stubs"};
+    std::unordered_map<std::string, std::unique_ptr<leader::NodeService::Stub>> stubs_;
 
+    std::unique_ptr<grpc::Server> server_;
+    std::vector<std::thread> threads_;  // workers, heartbeat and election
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    std::atomic<bool> stopping_{false};
+
+    Forwarder forwarder_;  // declared last: its flusher uses the stubs above
+
+    void EnqueueLocked(leader::Task task);
     void ProcessTasks();
+    float AdvertisedWaitMs() const;  // the expected_wait_ms heartbeats carry
     void SendHeartbeatToPeer(const std::string& peer_address);
     void ElectionLoop();
+    void ExpirePeersLocked();
+    bool SleepUnlessStopped(int ms);  // false once Stop() is called
+
+    leader::NodeService::Stub* GetStub(const std::string& peer_address);
+    std::string PickDispatchTarget(const leader::Task& task);
+    std::string PickAffinityTarget(const std::string& key);
+    float PeerLoad(const std::string& peer) const;
+    float PeerCapacity(const std::string& peer) const;
+    void RequeueFailedForward(const std::string& peer_address, std::vector<leader::Task>& tasks);
+    bool TryStealTasks();
 };
 
+using NodeServiceImpl = BasicNodeService<WeightedSumPolicy>;
+
+// Instantiated in node_server.cpp
+extern template class BasicNodeService<WeightedSumPolicy>;
+extern template class BasicNodeService<ExpectedWaitPolicy>;
+extern template class BasicNodeService<CapacityNormalizedPolicy>;
+extern template class BasicNodeService<DefaultSloPolicy>;
+
 #endif // NODE_SERVER_H
@@ -0,0 +1,101 @@
+#include "quantile.h"
+#include <algorithm>
+#include <cmath>
+
+P2Quantile::P2Quantile(double p) : p_(std::min(1.0, std::max(0.0, p))) {
+    const double desired[5] = {1.0, 1.0 + 2.0 * p_, 1.0 + 4.0 * p_, 3.0 + 2.0 * p_, 5.0};
+    const double increments[5] = {0.0, p_ / 2.0, p_, (1.0 + p_) / 2.0, 1.0};
+    for (int i = 0; i < 5; ++i) {
+        heights_[i] = 0.0;
+        positions_[i] = i + 1.0;
+        desired_[i] = desired[i];
+        increments_[i] = increments[i];
+    }
+}
+
+void P2Quantile::Add(double x) {
+    // The first five samples become the initial markers
+    if (count_ < 5) {
+        heights_[count_++] = x;
+        std::sort(heights_, heights_ + count_);
+        return;
+    }
+    ++count_;
+
+    int k;
+    if (x < heights_[0]) {
+        heights_[0] = x;
+        k = 0;
+    } else if (x >= heights_[4]) {
+        heights_[4] = std::max(heights_[4], x);
+        k = 3;
+    } else {
+        k = 0;
+        while (k < 3 && x >= heights_[k + 1]) {
+            ++k;
+        }
+    }
+
+    for (int i = k + 1; i < 5; ++i) {
+        positions_[i] += 1.0;
+    }
+    for (int i = 0; i < 5; ++i) {
+        desired_[i] += increments_[i];
+    }
+
+    // Move the middle markers toward their desired positions, one step at a time
+    for (int i = 1; i < 4; ++i) {
+        double d = desired_[i] - positions_[i];
+        if ((d >= 1.0 && positions_[i + 1] - positions_[i] > 1.0) ||
+            (d <= -1.0 && positions_[i - 1] - positions_[i] < -1.0)) {
+            double step = d > 0.0 ? 1.0 : -1.0;
+            double h = Parabolic(i, step);
+            if (h <= heights_[i - 1] || h >= heights_[i + 1]) {
+                h = Linear(i, step);
+            }
+            heights_[i] = h;
+            positions_[i] += step;
+        }
+    }
+}
+
+double P2Quantile::Parabolic(int i, double d) const {
+    double n0 = positions_[i - 1], n1 = positions_[i], n2 = positions_[i + 1];
+    return heights_[i] + d / (n2 - n0) *
+           ((n1 - n0 + d) * (heights_[i + 1] - heights_[i]) / (n2 - n1) +
+            (n2 - n1 - d) * (heights_[i] - heights_[i - 1]) / (n1 - n0));
+}
+
+double P2Quantile::Linear(int i, double d) const {
+    int j = i + static_cast<int>(d);
+    return heights_[i] + d * (heights_[j] - heights_[i]) / (positions_[j] - positions_[i]);
+}
+
+double P2Quantile::Value() const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+    if (count_ < 5) {
+        // Too few samples for markers: nearest rank over what we have
+        int rank = static_cast<int>(std::ceil(p_ * count_)) - 1;
+        return heights_[std::min<int64_t>(count_ - 1, std::max(0, rank))];
+    }
+    return heights_[2];
+}
+
+void RuntimeQuantiles::Record(double ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    p50_.Add(ms);
+    p90_.Add(ms);
+    p99_.Add(ms);
+}
+
+RuntimeQuantiles::Snapshot RuntimeQuantiles::Get() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Snapshot s;
+    s.count = p50_.count();
+    s.p50_ms = p50_.Value();
+    s.p90_ms = p90_.Value();
+    s.p99_ms = p99_.Value();
+    return s;
+}
@@ -0,0 +1,51 @@
+#ifndef QUANTILE_H
+#define QUANTILE_H
+
+#include <cstdint>
+#include <mutex>
+
+// Streaming estimate of one quantile with the P-square algorithm (Jain and
+// Chlamtac, 1985): five markers, O(1) memory and time per sample, no
+// stored samples. Not thread-safe.
+class P2Quantile {
+public:
+    explicit P2Quantile(double p);
+
+    void Add(double x);
+    double Value() const;  // 0 until the first sample
+    int64_t count() const { return count_; }
+
+private:
+    double p_;
+    int64_t count_ = 0;
+    double heights_[5];
+    double positions_[5];
+    double desired_[5];
+    double increments_[5];
+
+    double Parabolic(int i, double d) const;
+    double Linear(int i, double d) const;
+};
+
+// Task run times: p50, p90 and p99 plus a count, safe to record from every
+// worker thread.
+class RuntimeQuantiles {
+public:
+    struct Snapshot {
+        int64_t count = 0;
+        double p50_ms = 0.0;
+        double p90_ms = 0.0;
+        double p99_ms = 0.0;
+    };
+
+    void Record(double ms);
+    Snapshot Get() const;
+
+private:
+    mutable std::mutex mutex_;
+    P2Quantile p50_{0.5};
+    P2Quantile p90_{0.9};
+    P2Quantile p99_{0.99};
+};
+
+#endif // QUANTILE_H
@@ -0,0 +1,118 @@
+#include "score_index.h"
+#include <queue>
+
+uint32_t ScoreIndex::Update(const std::string& node, float score) {
+    auto it = ids_.find(node);
+    if (it == ids_.end()) {
+        uint32_t id;
+        if (!free_ids_.empty()) {
+            id = free_ids_.back();
+            free_ids_.pop_back();
+            names_[id] = node;
+            scores_[id] = score;
+        } else {
+            id = static_cast<uint32_t>(names_.size());
+            names_.push_back(node);
+            scores_.push_back(score);
+            slots_.push_back(0);
+        }
+        ids_.emplace(node, id);
+        heap_.push_back(id);
+        slots_[id] = heap_.size() - 1;
+        SiftUp(heap_.size() - 1);
+        return id;
+    }
+
+    uint32_t id = it->second;
+    float old = scores_[id];
+    scores_[id] = score;
+    if (score > old) {
+        SiftUp(slots_[id]);
+    } else if (score < old) {
+        SiftDown(slots_[id]);
+    }
+    return id;
+}
+
+void ScoreIndex::Remove(const std::string& node) {
+    auto it = ids_.find(node);
+    if (it == ids_.end()) {
+        return;
+    }
+    uint32_t id = it->second;
+    ids_.erase(it);
+    free_ids_.push_back(id);
+
+    size_t slot = slots_[id];
+    uint32_t last = heap_.back();
+    heap_.pop_back();
+    if (slot == heap_.size()) {
+        return;
+    }
+    Place(slot, last);
+    if (Better(last, id)) {
+        SiftUp(slot);
+    } else {
+        SiftDown(slot);
+    }
+}
+
+std::vector<std::pair<std::string, float>> ScoreIndex::TopK(size_t k) const {
+    std::vector<std::pair<std::string, float>> result;
+    if (heap_.empty() || k == 0) {
+        return result;
+    }
+
+    // Frontier of heap slots ordered by score; only children of slots already
+    // taken can come next, so this touches O(k) entries.
+    auto worse = [this](size_t a, size_t b) { return Better(heap_[b], heap_[a]); };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(worse)> frontier(worse);
+    frontier.push(0);
+    while (!frontier.empty() && result.size() < k) {
+        size_t slot = frontier.top();
+        frontier.pop();
+        result.emplace_back(names_[heap_[slot]], scores_[heap_[slot]]);
+        for (size_t c = 2 * slot + 1; c <= 2 * slot + 2 && c < heap_.size(); ++c) {
+            frontier.push(c);
+        }
+    }
+    return result;
+}
+
+void ScoreIndex::SiftUp(size_t slot) {
+    uint32_t id = heap_[slot];
+    while (slot > 0) {
+        size_t parent = (slot - 1) / 2;
+        if (!Better(id, heap_[parent])) {
+            break;
+        }
+        Place(slot, heap_[parent]);
+        slot = parent;
+    }
+    Place(slot, id);
+}
+
+void ScoreIndex::SiftDown(size_t slot) {
+    uint32_t id = heap_[slot];
+    size_t n = heap_.size();
+    while (true) {
+        size_t child = 2 * slot + 1;
+        if (child >= n) {
+            break;
+        }
+        if (child + 1 < n && Better(heap_[child + 1], heap_[child])) {
+            ++child;
+        }
+        if (!Better(heap_[child], id)) {
+            break;
+        }
+        Place(slot, heap_[child]);
+        slot = child;
+    }
+    Place(slot, id);
+}
+
+void ScoreIndex::Place(size_t slot, uint32_t id) {
+    heap_[slot] = id;
+    slots_[id] = slot;
+}
@@ -0,0 +1,50 @@
+#ifndef SCORE_INDEX_H
+#define SCORE_INDEX_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Max-heap of per-node scores. Nodes are interned to small integer ids, so an
+// Update() costs one hash lookup plus an O(log n) sift over integers. The best
+// node is always at the root and the k best come out in O(k log k), however
+// many nodes there are. Equal scores go to the smaller node name, so indexes
+// holding the same scores agree on the order.
+class ScoreIndex {
+public:
+    // Insert or change; returns the node's id, which is small, stable until
+    // the node is removed, and then reused
+    uint32_t Update(const std::string& node, float score);
+    void Remove(const std::string& node);
+
+    const std::string& NodeName(uint32_t id) const { return names_[id]; }
+
+    bool empty() const { return heap_.empty(); }
+    size_t size() const { return heap_.size(); }
+
+    // Best entry; only valid when !empty()
+    const std::string& TopNode() const { return names_[heap_[0]]; }
+    float TopScore() const { return scores_[heap_[0]]; }
+
+    // Up to k (node, score) pairs, best first
+    std::vector<std::pair<std::string, float>> TopK(size_t k) const;
+
+private:
+    bool Better(uint32_t a, uint32_t b) const {
+        return scores_[a] > scores_[b] || (scores_[a] == scores_[b] && names_[a] < names_[b]);
+    }
+    void SiftUp(size_t slot);
+    void SiftDown(size_t slot);
+    void Place(size_t slot, uint32_t id);
+
+    std::unordered_map<std::string, uint32_t> ids_;
+    std::vector<std::string> names_;   // by id
+    std::vector<float> scores_;        // by id
+    std::vector<size_t> slots_;        // by id: position in heap_
+    std::vector<uint32_t> free_ids_;   // ids of removed nodes, for reuse
+    std::vector<uint32_t> heap_;
+};
+
+#endif // SCORE_INDEX_H
@@ -0,0 +1,62 @@
+#ifndef SCORING_H
+#define SCORING_H
+
+#include "host_stats.h"
+#include <algorithm>
+
+// Everything a scoring policy may look at. Higher scores win elections.
+struct ScoreInputs {
+    HostLoad host;
+    float queue_length = 0.0f;      // smoothed
+    float backlog_ms = 0.0f;        // declared work queued and running, per worker
+    float expected_wait_ms = 0.0f;  // forecast wait for a new task
+    float capacity = 1.0f;          // how much work the node runs in parallel
+};
+
+// Scoring policies are plain types with a static Score(), picked at compile
+// time by BasicNodeService, so the call inlines into the heartbeat path.
+// Every node in a cluster must use the same policy for scores to compare.
+
+// The original formula: free CPU and memory, minus a queue penalty
+struct WeightedSumPolicy {
+    static constexpr const char* kName = "weighted";
+    static float Score(const ScoreInputs& in) {
+        return 0.5f * in.host.cpu_free + 0.3f * in.host.mem_free - 0.2f * in.queue_length;
+    }
+};
+
+// Rank purely by how long a new task would wait
+struct ExpectedWaitPolicy {
+    static constexpr const char* kName = "expected_wait";
+    static float Score(const ScoreInputs& in) {
+        return -std::max(in.backlog_ms, in.expected_wait_ms);
+    }
+};
+
+// Weighted sum, but the queue penalty is per unit of capacity, so a big node
+// with the same queue as a small one scores higher
+struct CapacityNormalizedPolicy {
+    static constexpr const char* kName = "capacity";
+    static float Score(const ScoreInputs& in) {
+        float capacity = std::max(1.0f, in.capacity);
+        return 0.5f * in.host.cpu_free + 0.3f * in.host.mem_free - 0.2f * in.queue_length / capacity;
+    }
+};
+
+// Any node expected to meet the latency target beats every node that is not.
+// Within the target, free resources decide; past it, the smaller miss wins.
+template <int TargetMs>
+struct LatencySloPolicy {
+    static constexpr const char* kName = "slo";
+    static float Score(const ScoreInputs& in) {
+        float wait = std::max(in.backlog_ms, in.expected_wait_ms);
+        if (wait <= TargetMs) {
+            return 1000.0f + WeightedSumPolicy::Score(in);
+        }
+        return TargetMs - wait;
+    }
+};
+
+using DefaultSloPolicy = LatencySloPolicy<500>;
+
+#endif // SCORING_H
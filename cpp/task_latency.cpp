@@ -0,0 +1,42 @@
+#include "task_latency.h"
+#include <chrono>
+
+constexpr int64_t kMaxLatencyUs = 3600LL * 1000 * 1000;
+
+int priority_class(int priority) {
+    return priority < 0 ? 0 : priority == 0 ? 1 : 2;
+}
+
+const char* phase_name(TaskPhase phase) {
+    switch (phase) {
+        case TaskPhase::RECEIVE: return "receive";
+        case TaskPhase::QUEUE:   return "queue";
+        case TaskPhase::EXECUTE: return "execute";
+        case TaskPhase::TOTAL:   return "total";
+    }
+    return "unknown";
+}
+
+const char* priority_class_name(int priority_class) {
+    static const char* names[kPriorityClasses] = {"low", "normal", "high"};
+    return names[priority_class];
+}
+
+int64_t wall_clock_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+TaskLatency::TaskLatency() {
+    for (int i = 0; i < kTaskPhases * kPriorityClasses; ++i) {
+        histograms_.push_back(std::make_unique<HdrHistogram>(kMaxLatencyUs, 2));
+    }
+}
+
+void TaskLatency::Record(TaskPhase phase, int priority, int64_t us) {
+    histograms_[static_cast<int>(phase) * kPriorityClasses + priority_class(priority)]->Record(us);
+}
+
+const HdrHistogram& TaskLatency::Get(TaskPhase phase, int priority_class) const {
+    return *histograms_[static_cast<int>(phase) * kPriorityClasses + priority_class];
+}
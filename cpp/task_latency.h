@@ -0,0 +1,43 @@
+#ifndef TASK_LATENCY_H
+#define TASK_LATENCY_H
+
+#include "hdr_histogram.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// A task's life on the node that runs it:
+//   RECEIVE  first received by any node (Task.received_us) until queued here;
+//            covers dispatch, forwarding batches and time queued on a node it
+//            was stolen from
+//   QUEUE    queued here until a worker picks it up
+//   EXECUTE  running
+//   TOTAL    first received until done
+// RECEIVE and TOTAL compare wall clocks, so across hosts they include skew.
+enum class TaskPhase { RECEIVE, QUEUE, EXECUTE, TOTAL };
+constexpr int kTaskPhases = 4;
+
+// Task.priority below 0 is low, 0 normal, above 0 high
+constexpr int kPriorityClasses = 3;
+int priority_class(int priority);
+
+const char* phase_name(TaskPhase phase);
+const char* priority_class_name(int priority_class);
+
+// Microseconds since the epoch, for Task.received_us
+int64_t wall_clock_us();
+
+// HDR histograms of each phase, per priority class, in microseconds up to
+// an hour with two significant digits. Record from any thread.
+class TaskLatency {
+public:
+    TaskLatency();
+
+    void Record(TaskPhase phase, int priority, int64_t us);
+    const HdrHistogram& Get(TaskPhase phase, int priority_class) const;
+
+private:
+    std::vector<std::unique_ptr<HdrHistogram>> histograms_;
+};
+
+#endif // TASK_LATENCY_H
@@ -0,0 +1,215 @@
+#include "task_trace.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char kMagic[8] = {'T', 'A', 'S', 'K', 'T', 'R', 'C', '1'};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kHeaderBytes = 16;
+constexpr int64_t kTenantMarker = -1;
+constexpr size_t kFlushBytes = 256 * 1024;
+constexpr int64_t kFlushIntervalUs = 1000 * 1000;
+constexpr uint64_t kReleaseBytes = 64ULL << 20;
+constexpr size_t kMaxTenantBytes = 256;
+constexpr size_t kMaxTenants = 1 << 16;  // later tenants are recorded as none
+
+int64_t steady_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+size_t padded(size_t bytes) {
+    return (bytes + 7) & ~size_t{7};
+}
+
+}  // namespace
+
+TaskTraceWriter::~TaskTraceWriter() {
+    Close();
+}
+
+bool TaskTraceWriter::Open(const std::string& path) {
+    Close();
+    std::lock_guard<std::mutex> lock(mutex_);
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        return false;
+    }
+    buffer_.reserve(kFlushBytes + 4096);
+    tenants_.clear();
+    last_arrival_us_ = 0;
+    last_flush_us_ = steady_us();
+    tasks_ = 0;
+    char header[kHeaderBytes];
+    uint32_t record_bytes = sizeof(TaskTraceRecord);
+    std::memcpy(header, kMagic, 8);
+    std::memcpy(header + 8, &kVersion, 4);
+    std::memcpy(header + 12, &record_bytes, 4);
+    Put(header, sizeof(header));
+    FlushLocked();
+    return true;
+}
+
+void TaskTraceWriter::Append(const leader::Task& task, int64_t arrival_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ < 0) {
+        return;
+    }
+    TaskTraceRecord record = {};
+    if (!task.tenant().empty()) {
+        std::string name = task.tenant().substr(0, kMaxTenantBytes);
+        auto it = tenants_.find(name);
+        if (it != tenants_.end()) {
+            record.tenant = it->second;
+        } else if (tenants_.size() < kMaxTenants) {
+            record.tenant = static_cast<uint32_t>(tenants_.size() + 1);
+            tenants_.emplace(name, record.tenant);
+            TaskTraceRecord define = {};
+            define.arrival_us = kTenantMarker;
+            std::memcpy(&define.task_id, &record.tenant, 4);
+            define.duration_ms = static_cast<int32_t>(name.size());
+            Put(&define, sizeof(define));
+            name.resize(padded(name.size()), '\0');
+            Put(name.data(), name.size());
+        }
+    }
+    // Handlers race to the lock, so arrivals a few us apart can come in out of order
+    last_arrival_us_ = std::max(last_arrival_us_, arrival_us);
+    record.arrival_us = last_arrival_us_;
+    record.task_id = task.task_id();
+    record.duration_ms = task.duration_ms();
+    record.priority = task.priority();
+    Put(&record, sizeof(record));
+    ++tasks_;
+    if (buffer_.size() >= kFlushBytes || steady_us() - last_flush_us_ >= kFlushIntervalUs) {
+        FlushLocked();
+    }
+}
+
+void TaskTraceWriter::Flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ >= 0 && !buffer_.empty()) {
+        FlushLocked();
+    }
+}
+
+void TaskTraceWriter::Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ < 0) {
+        return;
+    }
+    FlushLocked();
+    ::close(fd_);
+    fd_ = -1;
+}
+
+int64_t TaskTraceWriter::tasks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_;
+}
+
+void TaskTraceWriter::Put(const void* data, size_t bytes) {
+    const char* p = static_cast<const char*>(data);
+    buffer_.insert(buffer_.end(), p, p + bytes);
+}
+
+void TaskTraceWriter::FlushLocked() {
+    size_t done = 0;
+    while (done < buffer_.size()) {
+        ssize_t n = ::write(fd_, buffer_.data() + done, buffer_.size() - done);
+        if (n <= 0) {
+            break;  // disk full or gone; drop what is buffered rather than block handlers
+        }
+        done += static_cast<size_t>(n);
+    }
+    buffer_.clear();
+    last_flush_us_ = steady_us();
+}
+
+TaskTraceReader::~TaskTraceReader() {
+    if (data_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+bool TaskTraceReader::Open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error_ = "cannot open " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(kHeaderBytes)) {
+        ::close(fd);
+        error_ = path + " is too short for a task trace";
+        return false;
+    }
+    size_ = static_cast<uint64_t>(st.st_size);
+    void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        error_ = "cannot map " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    data_ = static_cast<const char*>(p);
+    ::madvise(p, size_, MADV_SEQUENTIAL);
+
+    uint32_t version;
+    uint32_t record_bytes;
+    std::memcpy(&version, data_ + 8, 4);
+    std::memcpy(&record_bytes, data_ + 12, 4);
+    if (std::memcmp(data_, kMagic, 8) != 0 || version != kVersion ||
+        record_bytes != sizeof(TaskTraceRecord)) {
+        ::munmap(p, size_);
+        data_ = nullptr;
+        error_ = path + " is not a version 1 task trace";
+        return false;
+    }
+    offset_ = kHeaderBytes;
+    return true;
+}
+
+bool TaskTraceReader::Next(TaskTraceRecord* record) {
+    while (data_ && offset_ + sizeof(TaskTraceRecord) <= size_) {
+        std::memcpy(record, data_ + offset_, sizeof(TaskTraceRecord));
+        if (record->arrival_us != kTenantMarker) {
+            offset_ += sizeof(TaskTraceRecord);
+            Release();
+            return true;
+        }
+        uint32_t id;
+        std::memcpy(&id, &record->task_id, 4);
+        size_t name_bytes = static_cast<uint32_t>(record->duration_ms);
+        uint64_t name_at = offset_ + sizeof(TaskTraceRecord);
+        if (id > kMaxTenants || name_at + padded(name_bytes) > size_) {
+            break;
+        }
+        if (id >= tenants_.size()) {
+            tenants_.resize(id + 1);
+        }
+        tenants_[id].assign(data_ + name_at, name_bytes);
+        offset_ = name_at + padded(name_bytes);
+    }
+    return false;
+}
+
+const std::string& TaskTraceReader::tenant(uint32_t id) const {
+    return id < tenants_.size() ? tenants_[id] : tenants_[0];
+}
+
+void TaskTraceReader::Release() {
+    if (offset_ - released_ < kReleaseBytes) {
+        return;
+    }
+    uint64_t page = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+    uint64_t end = offset_ / page * page;
+    ::madvise(const_cast<char*>(data_) + released_, end - released_, MADV_DONTNEED);
+    released_ = end;
+}
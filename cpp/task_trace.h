@@ -0,0 +1,94 @@
+#ifndef TASK_TRACE_H
+#define TASK_TRACE_H
+
+#include "leader.pb.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Compact binary record of task arrivals, for replaying real traffic against
+// a node. A file is a 16-byte header followed by 24-byte records, all in
+// host byte order:
+//
+//     header   "TASKTRC1", uint32 version, uint32 record bytes
+//     task     int64 arrival_us, int32 task_id, int32 duration_ms,
+//              int32 priority, uint32 tenant
+//     tenant   int64 -1, uint32 tenant, uint32 name bytes, 8 zero bytes,
+//              then the name, zero padded to a multiple of 8
+//
+// arrival_us is wall clock us since the epoch and never decreases. A task
+// names its tenant by a number defined by an earlier tenant record; 0 is
+// no tenant. A file cut short by a crash reads up to its last whole record.
+
+struct TaskTraceRecord {
+    int64_t arrival_us;
+    int32_t task_id;
+    int32_t duration_ms;
+    int32_t priority;
+    uint32_t tenant;
+};
+static_assert(sizeof(TaskTraceRecord) == 24, "trace records are 24 bytes");
+
+// Appends tasks to a trace file. Any method may be called from any thread.
+// Writes are buffered; they reach the file once 256 KB have gathered or a
+// second has passed since the last write, and on Flush() and Close().
+class TaskTraceWriter {
+public:
+    TaskTraceWriter() = default;
+    ~TaskTraceWriter();
+    TaskTraceWriter(const TaskTraceWriter&) = delete;
+    TaskTraceWriter& operator=(const TaskTraceWriter&) = delete;
+
+    bool Open(const std::string& path);  // truncates
+    void Append(const leader::Task& task, int64_t arrival_us);
+    void Flush();
+    void Close();
+    int64_t tasks() const;
+
+private:
+    mutable std::mutex mutex_;
+    int fd_ = -1;
+    std::vector<char> buffer_;
+    std::unordered_map<std::string, uint32_t> tenants_;
+    int64_t last_arrival_us_ = 0;
+    int64_t last_flush_us_ = 0;
+    int64_t tasks_ = 0;
+
+    void Put(const void* data, size_t bytes);
+    void FlushLocked();
+};
+
+// Reads a trace file through a read-only mapping, front to back, so traces
+// larger than memory stream: pages already read are dropped as it goes.
+//
+//     TaskTraceReader reader;
+//     TaskTraceRecord record;
+//     reader.Open(path);
+//     while (reader.Next(&record)) { ... reader.tenant(record.tenant) ... }
+class TaskTraceReader {
+public:
+    TaskTraceReader() = default;
+    ~TaskTraceReader();
+    TaskTraceReader(const TaskTraceReader&) = delete;
+    TaskTraceReader& operator=(const TaskTraceReader&) = delete;
+
+    bool Open(const std::string& path);  // false, with error() set, if not a trace
+    bool Next(TaskTraceRecord* record);  // false at the end
+    const std::string& tenant(uint32_t id) const;  // "" if unknown
+    uint64_t size_bytes() const { return size_; }
+    const std::string& error() const { return error_; }
+
+private:
+    const char* data_ = nullptr;
+    uint64_t size_ = 0;
+    uint64_t offset_ = 0;
+    uint64_t released_ = 0;  // pages before this were handed back to the kernel
+    std::vector<std::string> tenants_{""};
+    std::string error_;
+
+    void Release();
+};
+
+#endif // TASK_TRACE_H
@@ -0,0 +1,234 @@
+#include "trace.h"
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace trace_internal {
+std::atomic<bool> g_enabled{false};
+
+int64_t now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+}  // namespace trace_internal
+
+namespace {
+
+using trace_internal::Event;
+
+struct ThreadBuffer {
+    std::mutex mutex;  // owner appends, dump reads
+    int tid = 0;
+    std::string name;
+    std::vector<Event> events;  // ring, allocated on first use
+    uint64_t written = 0;       // ever appended; the ring holds the newest
+    uint64_t exported = 0;      // written when last cleared
+    bool retired = false;       // owner thread has exited
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    int next_tid = 1;
+};
+
+Registry& registry() {
+    static Registry* r = new Registry;
+    return *r;
+}
+
+// Owned by each tracing thread; retires the buffer when the thread exits
+struct BufferOwner {
+    std::shared_ptr<ThreadBuffer> buffer;
+    ~BufferOwner() {
+        if (buffer) {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            buffer->retired = true;
+        }
+    }
+};
+
+thread_local BufferOwner t_buffer;
+
+ThreadBuffer& thread_buffer() {
+    if (!t_buffer.buffer) {
+        auto buffer = std::make_shared<ThreadBuffer>();
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        buffer->tid = r.next_tid++;
+        r.buffers.push_back(buffer);
+        t_buffer.buffer = std::move(buffer);
+    }
+    return *t_buffer.buffer;
+}
+
+void append_escaped(const char* s, size_t n, std::string& out) {
+    for (size_t i = 0; i < n; ++i) {
+        char c = s[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else {
+            out += c;
+        }
+    }
+}
+
+void append_string(const std::string& s, std::string& out) {
+    out += '"';
+    append_escaped(s.data(), s.size(), out);
+    out += '"';
+}
+
+// "pid":P,"tid":T
+std::string ids(int pid, int tid) {
+    return "\"pid\":" + std::to_string(pid) + ",\"tid\":" + std::to_string(tid);
+}
+
+void append_flow(char phase, uint64_t id, const Event& e, const std::string& where, std::string& out) {
+    char buf[160];
+    std::snprintf(buf, sizeof(buf),
+                  ",{\"name\":\"%s\",\"cat\":\"flow\",\"ph\":\"%c\",\"id\":\"0x%" PRIx64 "\",\"ts\":%" PRId64 "%s,",
+                  e.category, phase, id, e.ts_us, phase == 'f' ? ",\"bp\":\"e\"" : "");
+    out += buf;
+    out += where;
+    out += '}';
+}
+
+void append_event(const Event& e, const std::string& where, std::string& out) {
+    char buf[128];
+    std::snprintf(buf, sizeof(buf), ",{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%" PRId64 ",",
+                  e.name, e.category, e.phase, e.ts_us);
+    out += buf;
+    if (e.phase == 'X') {
+        out += "\"dur\":" + std::to_string(e.dur_us) + ",";
+    } else {
+        out += "\"s\":\"t\",";
+    }
+    out += where;
+    if (e.nargs > 0) {
+        out += ",\"args\":{";
+        for (int i = 0; i < e.nargs; ++i) {
+            out += i > 0 ? ",\"" : "\"";
+            out += e.keys[i];
+            out += "\":";
+            if (e.is_text[i]) {
+                out += '"';
+                append_escaped(e.text + (e.values[i] & 0xff), static_cast<size_t>(e.values[i] >> 8), out);
+                out += '"';
+            } else {
+                out += std::to_string(e.values[i]);
+            }
+        }
+        out += '}';
+    }
+    out += '}';
+
+    // Perfetto binds a flow end to the enclosing span, so both ends sit at the span's start
+    if (e.flow_out != 0) {
+        append_flow('s', e.flow_out, e, where, out);
+    }
+    if (e.flow_in != 0) {
+        append_flow('f', e.flow_in, e, where, out);
+    }
+}
+
+}  // namespace
+
+namespace trace_internal {
+
+void submit(const Event& e) {
+    ThreadBuffer& b = thread_buffer();
+    std::lock_guard<std::mutex> lock(b.mutex);
+    if (b.events.empty()) {
+        b.events.resize(kTraceEventsPerThread);
+    }
+    b.events[b.written % kTraceEventsPerThread] = e;
+    ++b.written;
+}
+
+}  // namespace trace_internal
+
+void trace_set_enabled(bool on) {
+    trace_internal::g_enabled.store(on, std::memory_order_relaxed);
+}
+
+void trace_set_thread_name(const std::string& name) {
+    ThreadBuffer& b = thread_buffer();
+    std::lock_guard<std::mutex> lock(b.mutex);
+    b.name = name;
+}
+
+void trace_instant(const char* category, const char* name, const char* key, const std::string& value) {
+    if (!trace_internal::enabled()) {
+        return;
+    }
+    Event e;
+    e.category = category;
+    e.name = name;
+    e.phase = 'i';
+    e.nargs = 0;
+    e.text_used = 0;
+    e.ts_us = trace_internal::now_us();
+    e.dur_us = 0;
+    e.flow_out = 0;
+    e.flow_in = 0;
+    if (key) {
+        trace_internal::add_text(e, key, value.data(), value.size());
+    }
+    trace_internal::submit(e);
+}
+
+std::string trace_dump_events(const std::string& process_name, bool clear,
+                              int64_t* events, int64_t* dropped) {
+    // Nodes in one merged trace need distinct pids even when they share a host
+    int pid = static_cast<int>(std::hash<std::string>()(process_name) & 0x7fffffff);
+    std::string out = "{\"name\":\"process_name\",\"ph\":\"M\"," + ids(pid, 0) + ",\"args\":{\"name\":";
+    append_string(process_name, out);
+    out += "}}";
+
+    int64_t exported = 0;
+    int64_t overwritten = 0;
+    Registry& r = registry();
+    std::lock_guard<std::mutex> registry_lock(r.mutex);
+    for (auto it = r.buffers.begin(); it != r.buffers.end();) {
+        ThreadBuffer& b = **it;
+        std::unique_lock<std::mutex> lock(b.mutex);
+        std::string where = ids(pid, b.tid);
+        if (!b.name.empty()) {
+            out += ",{\"name\":\"thread_name\",\"ph\":\"M\"," + where + ",\"args\":{\"name\":";
+            append_string(b.name, out);
+            out += "}}";
+        }
+        uint64_t first = std::max(b.exported, b.written > kTraceEventsPerThread ? b.written - kTraceEventsPerThread : 0);
+        overwritten += static_cast<int64_t>(first - b.exported);
+        for (uint64_t i = first; i < b.written; ++i) {
+            append_event(b.events[i % kTraceEventsPerThread], where, out);
+            ++exported;
+        }
+        if (clear) {
+            b.exported = b.written;
+            if (b.retired) {
+                lock.unlock();
+                it = r.buffers.erase(it);
+                continue;
+            }
+        }
+        ++it;
+    }
+    if (events) {
+        *events = exported;
+    }
+    if (dropped) {
+        *dropped = overwritten;
+    }
+    return out;
+}
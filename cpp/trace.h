@@ -0,0 +1,149 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Timeline of what a node's threads did, exported as Chrome trace events
+// (load into Perfetto or chrome://tracing). Off by default; while off a
+// TraceSpan costs one relaxed load. While on, each thread appends to its
+// own ring of the newest kTraceEventsPerThread events, behind a mutex that
+// only the dump ever contends. Timestamps are wall clock microseconds, so
+// dumps from several nodes line up when merged.
+//
+// Category, name and argument keys must be string literals, e.g.
+//     TraceSpan span("task", "run");
+//     span.Arg("task_id", task.task_id());
+//     span.Arg("peer", peer_address);
+
+constexpr size_t kTraceEventsPerThread = 8192;
+
+void trace_set_enabled(bool on);
+
+// Track name for the calling thread in the exported timeline
+void trace_set_thread_name(const std::string& name);
+
+// Everything recorded so far as Chrome trace events, comma separated (wrap
+// in {"traceEvents":[...]} to load), with process_name naming the pid
+// track. clear drops the events afterwards. events and dropped, if given,
+// get how many were exported and how many the rings overwrote.
+std::string trace_dump_events(const std::string& process_name, bool clear,
+                              int64_t* events = nullptr, int64_t* dropped = nullptr);
+
+namespace trace_internal {
+
+constexpr int kMaxArgs = 4;
+constexpr size_t kTextBytes = 64;  // shared by all text arguments, truncated beyond
+
+extern std::atomic<bool> g_enabled;
+
+inline bool enabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+int64_t now_us();
+
+struct Event {
+    const char* category;
+    const char* name;
+    char phase;        // 'X' span, 'i' instant
+    uint8_t nargs;
+    uint8_t text_used;
+    int64_t ts_us;
+    int64_t dur_us;
+    uint64_t flow_out;  // nonzero: a flow arrow starts in this span
+    uint64_t flow_in;   // nonzero: a flow arrow ends in this span
+    const char* keys[kMaxArgs];
+    int64_t values[kMaxArgs];  // or, for text arguments, length << 8 | offset
+    bool is_text[kMaxArgs];
+    char text[kTextBytes];
+};
+
+void submit(const Event& e);
+
+inline void add_int(Event& e, const char* key, int64_t v) {
+    if (e.nargs < kMaxArgs) {
+        e.keys[e.nargs] = key;
+        e.values[e.nargs] = v;
+        e.is_text[e.nargs++] = false;
+    }
+}
+
+inline void add_text(Event& e, const char* key, const char* s, size_t n) {
+    if (e.nargs < kMaxArgs) {
+        n = std::min(n, kTextBytes - e.text_used);
+        std::memcpy(e.text + e.text_used, s, n);
+        e.keys[e.nargs] = key;
+        e.values[e.nargs] = static_cast<int64_t>(n << 8 | e.text_used);
+        e.is_text[e.nargs++] = true;
+        e.text_used = static_cast<uint8_t>(e.text_used + n);
+    }
+}
+
+}  // namespace trace_internal
+
+inline bool trace_enabled() {
+    return trace_internal::enabled();
+}
+
+// A span from construction to destruction, recorded only if tracing was on
+// when it began
+class TraceSpan {
+public:
+    TraceSpan(const char* category, const char* name) : active_(trace_internal::enabled()) {
+        if (active_) {
+            event_.category = category;
+            event_.name = name;
+            event_.phase = 'X';
+            event_.nargs = 0;
+            event_.text_used = 0;
+            event_.flow_out = 0;
+            event_.flow_in = 0;
+            event_.ts_us = trace_internal::now_us();
+        }
+    }
+    ~TraceSpan() {
+        if (active_) {
+            event_.dur_us = trace_internal::now_us() - event_.ts_us;
+            trace_internal::submit(event_);
+        }
+    }
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    void Arg(const char* key, int64_t v) {
+        if (active_) {
+            trace_internal::add_int(event_, key, v);
+        }
+    }
+    void Arg(const char* key, const std::string& v) {
+        if (active_) {
+            trace_internal::add_text(event_, key, v.data(), v.size());
+        }
+    }
+    // Links spans on different threads or nodes that share flow id, e.g.
+    // where a task was received to where it ran
+    void FlowOut(uint64_t id) {
+        if (active_) {
+            event_.flow_out = id;
+        }
+    }
+    void FlowIn(uint64_t id) {
+        if (active_) {
+            event_.flow_in = id;
+        }
+    }
+
+private:
+    bool active_;
+    trace_internal::Event event_;
+};
+
+// A point in time on the calling thread's track, with one optional argument
+void trace_instant(const char* category, const char* name,
+                   const char* key = nullptr, const std::string& value = "");
+
+#endif // TRACE_H
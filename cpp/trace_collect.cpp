@@ -0,0 +1,86 @@
+#include "leader.grpc.pb.h"
+#include "utils.h"
+#include <grpcpp/grpcpp.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Records a cluster-wide timeline: switches tracing on at every node in the
+// peers file, waits, then collects each node's events into one Chrome trace
+// JSON file for Perfetto (ui.perfetto.dev) or chrome://tracing.
+//
+//   ./trace_collect peers.txt trace.json --seconds=10
+//
+// With --seconds=0 it only collects what nodes started with --trace=on hold.
+
+static leader::TraceReply call_trace(const std::string& peer, bool enable, bool collect) {
+    grpc::ChannelArguments args;
+    args.SetMaxReceiveMessageSize(-1);  // a busy node's dump is well over the 4 MB default
+    auto stub = leader::NodeService::NewStub(
+        grpc::CreateCustomChannel(peer, grpc::InsecureChannelCredentials(), args));
+
+    leader::TraceRequest request;
+    request.set_enable(enable);
+    request.set_collect(collect);
+    leader::TraceReply reply;
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(10));
+    grpc::Status s = stub->Trace(&context, request, &reply);
+    if (!s.ok()) {
+        std::cerr << peer << ": " << s.error_message() << "\n";
+    }
+    return reply;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: ./trace_collect <peers_file> <out.json> [--seconds=n]\n";
+        return 1;
+    }
+    std::vector<std::string> peers = load_peers(argv[1]);
+    if (peers.empty()) {
+        std::cerr << "No peers found in file.\n";
+        return 1;
+    }
+    int seconds = 10;
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--seconds=", 0) == 0) {
+            seconds = std::max(0, std::atoi(arg.c_str() + 10));
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    if (seconds > 0) {
+        for (const auto& peer : peers) {
+            call_trace(peer, true, true);  // start clean
+        }
+        std::printf("tracing %zu nodes for %ds\n", peers.size(), seconds);
+        std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    }
+
+    std::ofstream out(argv[2]);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& peer : peers) {
+        leader::TraceReply reply = call_trace(peer, false, true);
+        if (reply.events_json().empty()) {
+            continue;
+        }
+        out << (first ? "" : ",") << reply.events_json();
+        first = false;
+        std::printf("%-24s %8lld events %8lld dropped\n", peer.c_str(),
+                    static_cast<long long>(reply.events()), static_cast<long long>(reply.dropped()));
+    }
+    out << "],\"displayTimeUnit\":\"ms\"}\n";
+    std::printf("wrote %s\n", argv[2]);
+    return 0;
+}
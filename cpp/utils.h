@@ -2,8 +2,11 @@
 #define UTILS_H
 
 #include <string>
+#include <vector>
 
-float compute_score(int queue_length);
 void simulate_task(int task_id, int duration_ms);
 
+// Peer addresses from a config file (one per line)
+std::vector<std::string> load_peers(const std::string& filename);
+
 #endif // UTILS_H
@@ -0,0 +1,208 @@
+#include "workload.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+bool parse_duration_model(const std::string& value, DurationModel* model) {
+    if (value == "fixed") {
+        *model = DurationModel::FIXED;
+    } else if (value == "pareto") {
+        *model = DurationModel::PARETO;
+    } else if (value == "lognormal") {
+        *model = DurationModel::LOGNORMAL;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* duration_model_name(DurationModel model) {
+    switch (model) {
+    case DurationModel::PARETO:
+        return "pareto";
+    case DurationModel::LOGNORMAL:
+        return "lognormal";
+    default:
+        return "fixed";
+    }
+}
+
+}  // namespace
+
+bool parse_workload_option(const std::string& arg, WorkloadOptions* options) {
+    size_t eq = arg.find('=');
+    if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+        return false;
+    }
+    std::string name = arg.substr(2, eq - 2);
+    std::string value = arg.substr(eq + 1);
+
+    if (name == "rate") {
+        options->rate = std::max(0.001, std::atof(value.c_str()));
+    } else if (name == "arrival") {
+        if (value != "poisson" && value != "fixed") {
+            return false;
+        }
+        options->poisson = value == "poisson";
+    } else if (name == "durations") {
+        return parse_duration_model(value, &options->durations);
+    } else if (name == "task_ms") {
+        options->task_ms = std::max(0, std::atoi(value.c_str()));
+    } else if (name == "task_max_ms") {
+        options->task_max_ms = std::max(1, std::atoi(value.c_str()));
+    } else if (name == "pareto_alpha") {
+        double alpha = std::atof(value.c_str());
+        if (alpha <= 1.0) {
+            return false;  // no finite mean
+        }
+        options->pareto_alpha = alpha;
+    } else if (name == "lognormal_sigma") {
+        options->lognormal_sigma = std::max(0.0, std::atof(value.c_str()));
+    } else if (name == "burst_on_ms") {
+        options->burst_on_ms = std::max(0.0, std::atof(value.c_str()));
+    } else if (name == "burst_off_ms") {
+        options->burst_off_ms = std::max(0.0, std::atof(value.c_str()));
+    } else if (name == "diurnal_period_s") {
+        options->diurnal_period_s = std::max(0.0, std::atof(value.c_str()));
+    } else if (name == "diurnal_amplitude") {
+        options->diurnal_amplitude = std::clamp(std::atof(value.c_str()), 0.0, 1.0);
+    } else if (name == "tenants") {
+        options->tenants = std::max(0, std::atoi(value.c_str()));
+    } else if (name == "zipf_s") {
+        options->zipf_s = std::max(0.0, std::atof(value.c_str()));
+    } else if (name == "tenant_keys") {
+        if (value != "on" && value != "off") {
+            return false;
+        }
+        options->tenant_keys = value == "on";
+    } else if (name == "seed") {
+        options->seed = std::strtoull(value.c_str(), nullptr, 10);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string describe_workload(const WorkloadOptions& options) {
+    char buf[256];
+    std::string out;
+    std::snprintf(buf, sizeof(buf), "%s %.0f tasks/s, %s task_ms mean %d", options.poisson ? "poisson" : "fixed",
+                  options.rate, duration_model_name(options.durations), options.task_ms);
+    out += buf;
+    if (options.durations == DurationModel::PARETO) {
+        std::snprintf(buf, sizeof(buf), " alpha %g", options.pareto_alpha);
+        out += buf;
+    } else if (options.durations == DurationModel::LOGNORMAL) {
+        std::snprintf(buf, sizeof(buf), " sigma %g", options.lognormal_sigma);
+        out += buf;
+    }
+    if (options.burst_on_ms > 0 && options.burst_off_ms > 0) {
+        std::snprintf(buf, sizeof(buf), ", bursts %g ms on / %g ms off", options.burst_on_ms, options.burst_off_ms);
+        out += buf;
+    }
+    if (options.diurnal_period_s > 0) {
+        std::snprintf(buf, sizeof(buf), ", diurnal +-%.0f%% over %gs", options.diurnal_amplitude * 100,
+                      options.diurnal_period_s);
+        out += buf;
+    }
+    if (options.tenants > 0) {
+        std::snprintf(buf, sizeof(buf), ", %d tenants zipf %g%s", options.tenants, options.zipf_s,
+                      options.tenant_keys ? " as routing keys" : "");
+        out += buf;
+    }
+    return out;
+}
+
+Workload::Workload(const WorkloadOptions& options, double duration_s) : options_(options) {
+    if (options_.burst_on_ms > 0 && options_.burst_off_ms > 0) {
+        std::mt19937_64 rng(options_.seed);
+        std::exponential_distribution<double> on(1000.0 / options_.burst_on_ms);
+        std::exponential_distribution<double> off(1000.0 / options_.burst_off_ms);
+        double t = on(rng);
+        while (t < duration_s) {
+            off_periods_.push_back(t);
+            t += off(rng);
+            off_periods_.push_back(t);
+            t += on(rng);
+        }
+        burst_factor_ = (options_.burst_on_ms + options_.burst_off_ms) / options_.burst_on_ms;
+    }
+    max_factor_ = burst_factor_;
+    if (options_.diurnal_period_s > 0) {
+        max_factor_ *= 1.0 + options_.diurnal_amplitude;
+    }
+    for (int k = 0; k < options_.tenants; ++k) {
+        tenant_names_.push_back("tenant-" + std::to_string(k));
+        tenant_weights_.push_back(1.0 / std::pow(k + 1, options_.zipf_s));
+    }
+}
+
+double Workload::RateFactor(double t_s) const {
+    // An odd count of boundaries at or before t_s means t_s is in an off period
+    size_t passed = std::upper_bound(off_periods_.begin(), off_periods_.end(), t_s) - off_periods_.begin();
+    if (passed % 2 == 1) {
+        return 0.0;
+    }
+    double factor = burst_factor_;
+    if (options_.diurnal_period_s > 0) {
+        factor *= 1.0 + options_.diurnal_amplitude * std::sin(2.0 * kPi * t_s / options_.diurnal_period_s);
+    }
+    return factor;
+}
+
+double Workload::NextOn(double t_s) const {
+    size_t passed = std::upper_bound(off_periods_.begin(), off_periods_.end(), t_s) - off_periods_.begin();
+    return passed % 2 == 1 ? off_periods_[passed] : t_s;
+}
+
+WorkloadStream::WorkloadStream(const Workload& workload, int index, int streams)
+    : workload_(workload),
+      rng_(workload.options_.seed * 1000003 + static_cast<uint64_t>(index)),
+      rate_(workload.options_.rate / streams),
+      tenant_(workload.tenant_weights_.begin(), workload.tenant_weights_.end()) {}
+
+double WorkloadStream::NextArrival() {
+    if (workload_.options_.poisson) {
+        // Thinning: candidates at the peak rate, kept in proportion to the rate at the time
+        std::exponential_distribution<double> gap(rate_ * workload_.MaxRateFactor());
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        do {
+            t_s_ += gap(rng_);
+        } while (unit(rng_) * workload_.MaxRateFactor() > workload_.RateFactor(t_s_));
+        return t_s_;
+    }
+    // Evenly spaced at the rate where the gap starts; an off period pushes the
+    // next task to the start of the following on period
+    t_s_ = workload_.NextOn(t_s_);
+    double factor = std::max(workload_.RateFactor(t_s_), 0.01);
+    t_s_ = workload_.NextOn(t_s_ + 1.0 / (rate_ * factor));
+    return t_s_;
+}
+
+int32_t WorkloadStream::Duration() {
+    const WorkloadOptions& o = workload_.options_;
+    double ms = o.task_ms;
+    if (ms <= 0) {
+        return 0;
+    }
+    if (o.durations == DurationModel::PARETO) {
+        // Scale x_m gives mean task_ms: mean = alpha x_m / (alpha - 1)
+        double scale = o.task_ms * (o.pareto_alpha - 1.0) / o.pareto_alpha;
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng_);
+        ms = scale / std::pow(1.0 - u, 1.0 / o.pareto_alpha);
+    } else if (o.durations == DurationModel::LOGNORMAL) {
+        // mu gives mean task_ms: mean = exp(mu + sigma^2 / 2)
+        double mu = std::log(ms) - o.lognormal_sigma * o.lognormal_sigma / 2.0;
+        ms = std::lognormal_distribution<double>(mu, o.lognormal_sigma)(rng_);
+    }
+    return static_cast<int32_t>(std::min<double>(std::llround(ms), o.task_max_ms));
+}
+
+int WorkloadStream::Tenant() {
+    return workload_.options_.tenants > 0 ? tenant_(rng_) : -1;
+}
@@ -0,0 +1,95 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// Synthetic task streams for loadgen: when tasks arrive, how long each
+// claims to run and which tenant sends it. The models, each off by default:
+//
+//   durations   fixed, pareto (shape pareto_alpha) or lognormal (sigma
+//               lognormal_sigma), all with mean task_ms, capped at task_max_ms
+//   bursts      arrivals only in on periods, on and off lengths exponential
+//               with means burst_on_ms and burst_off_ms; the on rate is
+//               raised so the mean rate is unchanged
+//   diurnal     rate x (1 + diurnal_amplitude sin(2 pi t / diurnal_period_s)),
+//               starting at the mean and rising
+//   tenants     tenant-0 .. tenant-(n-1), picked with Zipf weights 1 / (k+1)^zipf_s
+//
+// Bursts and the diurnal curve depend on the seed only, so every stream sees
+// the same on periods and the node gets the whole burst at once. Given the
+// seed, the tasks each stream sends are the same from run to run.
+
+enum class DurationModel { FIXED, PARETO, LOGNORMAL };
+
+struct WorkloadOptions {
+    double rate = 1000.0;  // tasks per second, over all streams
+    bool poisson = true;   // else evenly spaced
+    DurationModel durations = DurationModel::FIXED;
+    int task_ms = 10;      // mean duration_ms
+    int task_max_ms = 60000;
+    double pareto_alpha = 1.5;     // above 1; lower is heavier tailed
+    double lognormal_sigma = 1.0;
+    double burst_on_ms = 0.0;      // 0: no bursts
+    double burst_off_ms = 0.0;
+    double diurnal_period_s = 0.0; // 0: flat
+    double diurnal_amplitude = 0.5;  // in [0, 1]
+    int tenants = 0;               // 0: tasks carry no tenant
+    double zipf_s = 1.1;
+    bool tenant_keys = false;      // also use the tenant as the routing_key
+    uint64_t seed = 1;
+};
+
+// Parses one --name=value workload option; false if it is not one
+bool parse_workload_option(const std::string& arg, WorkloadOptions* options);
+
+std::string describe_workload(const WorkloadOptions& options);
+
+// The shared part of a workload over duration_s seconds: the burst schedule
+// and the tenant weights. Const after construction, so streams on several
+// threads can use one Workload, each with its own WorkloadStream.
+class Workload {
+public:
+    Workload(const WorkloadOptions& options, double duration_s);
+
+    const WorkloadOptions& options() const { return options_; }
+    // Rate at t_s seconds over the mean rate; 0 in an off period
+    double RateFactor(double t_s) const;
+    double MaxRateFactor() const { return max_factor_; }
+    // The first time at or after t_s that is not in an off period
+    double NextOn(double t_s) const;
+    const std::string& tenant(size_t i) const { return tenant_names_[i]; }
+
+private:
+    friend class WorkloadStream;
+    WorkloadOptions options_;
+    std::vector<double> off_periods_;  // start, end, start, end ... in seconds
+    double burst_factor_ = 1.0;
+    double max_factor_ = 1.0;
+    std::vector<std::string> tenant_names_;
+    std::vector<double> tenant_weights_;
+};
+
+// One of streams equal shares of a workload, with its own random source.
+// Used by one thread.
+class WorkloadStream {
+public:
+    WorkloadStream(const Workload& workload, int index, int streams);
+
+    // Seconds since the start at which the stream's next task arrives
+    double NextArrival();
+    int32_t Duration();
+    // Index into Workload::tenant, -1 with no tenants
+    int Tenant();
+
+private:
+    const Workload& workload_;
+    std::mt19937_64 rng_;
+    double rate_;
+    double t_s_ = 0.0;
+    std::discrete_distribution<int> tenant_;
+};
+
+#endif // WORKLOAD_H